@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * The Universal Permissive License (UPL), Version 1.0
+ *
+ * Subject to the condition set forth below, permission is hereby granted to any
+ * person obtaining a copy of this software, associated documentation and/or
+ * data (collectively the "Software"), free of charge and under any and all
+ * copyright rights in the Software, and any and all patent rights owned or
+ * freely licensable by each licensor hereunder covering either (i) the
+ * unmodified Software as contributed to or provided by such licensor, or (ii)
+ * the Larger Works (as defined below), to deal in both
+ *
+ * (a) the Software, and
+ *
+ * (b) any piece of software and/or hardware listed in the lrgrwrks.txt file if
+ * one is included with the Software each a "Larger Work" to which the Software
+ * is contributed by such licensors),
+ *
+ * without restriction, including without limitation the rights to copy, create
+ * derivative works of, display, perform, and distribute the Software and make,
+ * use, sell, offer for sale, import, export, have made, and have sold the
+ * Software and the Larger Work(s), and to sublicense the foregoing rights on
+ * either these or other terms.
+ *
+ * This license is subject to the following condition:
+ *
+ * The above copyright notice and either this complete permission notice or at a
+ * minimum a reference to the UPL must be included in all copies or substantial
+ * portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+package org.graalvm.nativeimage;
+
+import java.util.Objects;
+
+import org.graalvm.nativeimage.impl.PerformanceCountersSupport;
+
+/**
+ * Counters and histograms that are defined at image build time and updated at image run time. If
+ * the image is built with jvmstat support ({@code --enable-monitoring=jvmstat}), they are exported
+ * as performance data, so that tools such as {@code jstat} can read them from a running image.
+ * Otherwise, only the application itself can read them.
+ * <p>
+ * Updates are lock-free and designed for values that many threads update frequently. They are
+ * spread over multiple memory locations, which are only combined when the value is read or
+ * exported.
+ *
+ * @since 23.0
+ */
+public final class PerformanceCounters {
+
+    /**
+     * A counter that is created with {@link PerformanceCounters#createCounter}.
+     *
+     * @since 23.0
+     */
+    public interface Counter {
+        /**
+         * Adds one to the counter.
+         *
+         * @since 23.0
+         */
+        void increment();
+
+        /**
+         * Adds the given value to the counter.
+         *
+         * @since 23.0
+         */
+        void add(long delta);
+
+        /**
+         * Returns the current value of the counter. Concurrent updates may or may not be included.
+         *
+         * @since 23.0
+         */
+        long get();
+    }
+
+    /**
+     * A histogram that is created with {@link PerformanceCounters#createHistogram}.
+     *
+     * @since 23.0
+     */
+    public interface Histogram {
+        /**
+         * Counts the value in the first bucket whose limit is greater than or equal to it, or in
+         * the overflow bucket if the value is larger than all limits.
+         *
+         * @since 23.0
+         */
+        void record(long value);
+
+        /**
+         * Returns the number of values recorded in the given bucket. The overflow bucket has the
+         * index {@code bucketLimits.length}.
+         *
+         * @since 23.0
+         */
+        long getCount(int bucket);
+
+        /**
+         * Returns the sum of all recorded values.
+         *
+         * @since 23.0
+         */
+        long getSum();
+    }
+
+    /**
+     * Creates a counter. If the image exports performance data, the counter is exported under the
+     * given name, which must be unique, e.g., {@code com.example.requests}.
+     *
+     * @since 23.0
+     */
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public static Counter createCounter(String name) {
+        Objects.requireNonNull(name);
+        return ImageSingletons.lookup(PerformanceCountersSupport.class).createCounter(name);
+    }
+
+    /**
+     * Creates a histogram with the given inclusive upper bucket limits, which must be strictly
+     * increasing. Values above the last limit are counted in an additional overflow bucket. If the
+     * image exports performance data, the histogram is exported under the given name, which must
+     * be unique.
+     *
+     * @since 23.0
+     */
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public static Histogram createHistogram(String name, long... bucketLimits) {
+        Objects.requireNonNull(name);
+        if (bucketLimits.length == 0) {
+            throw new IllegalArgumentException("At least one bucket limit is required.");
+        }
+        for (int i = 1; i < bucketLimits.length; i++) {
+            if (bucketLimits[i - 1] >= bucketLimits[i]) {
+                throw new IllegalArgumentException("Bucket limits must be strictly increasing.");
+            }
+        }
+        return ImageSingletons.lookup(PerformanceCountersSupport.class).createHistogram(name, bucketLimits.clone());
+    }
+
+    private PerformanceCounters() {
+    }
+}
@@ -35,6 +35,12 @@ import com.oracle.graal.pointsto.util.AnalysisError;
 
 public class MultiTypeState extends TypeState {
 
+    /**
+     * Type states with at least this many types share their bit set with all equal type states.
+     * Smaller bit sets are cheap enough that interning them would cost more than it saves.
+     */
+    private static final int INTERNING_THRESHOLD = 16;
+
     /**
      * Keep a bit set for types to easily answer queries like contains type or types count, and
      * quickly iterate over the types.
@@ -50,7 +56,8 @@ public class MultiTypeState extends TypeState {
     /** Creates a new type state using the provided types bit set and objects. */
     public MultiTypeState(PointsToAnalysis bb, boolean canBeNull, BitSet typesBitSet, int typesCount) {
         assert !TypeStateUtils.needsTrim(typesBitSet);
-        this.typesBitSet = typesBitSet;
+        boolean intern = typesCount >= INTERNING_THRESHOLD && TypeStateBitSetInterner.isEnabled(bb.getOptions());
+        this.typesBitSet = intern ? TypeStateBitSetInterner.intern(typesBitSet) : typesBitSet;
         this.typesCount = typesCount;
         this.canBeNull = canBeNull;
         this.merged = false;
@@ -185,7 +192,7 @@ public class MultiTypeState extends TypeState {
 
         MultiTypeState that = (MultiTypeState) o;
         return this.canBeNull == that.canBeNull &&
-                        this.typesCount == that.typesCount && this.typesBitSet.equals(that.typesBitSet);
+                        this.typesCount == that.typesCount && (this.typesBitSet == that.typesBitSet || this.typesBitSet.equals(that.typesBitSet));
     }
 
     @Override
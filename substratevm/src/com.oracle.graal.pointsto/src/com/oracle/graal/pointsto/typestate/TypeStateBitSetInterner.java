@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.graal.pointsto.typestate;
+
+import java.lang.ref.WeakReference;
+import java.util.BitSet;
+import java.util.WeakHashMap;
+
+import org.graalvm.compiler.options.Option;
+import org.graalvm.compiler.options.OptionKey;
+import org.graalvm.compiler.options.OptionValues;
+
+/**
+ * Canonicalizes the immutable type bit sets of {@link MultiTypeState}s. Large analyses create many
+ * type states with identical types, e.g., for flows that converge to the same set of subtypes.
+ * Sharing one bit set for all of them saves memory and lets {@link MultiTypeState#equals} succeed
+ * on an identity check.
+ * <p>
+ * The canonical bit sets are only weakly referenced, so they are released together with the last
+ * type state that uses them. The table is split into stripes to reduce contention between the
+ * analysis threads.
+ * <p>
+ * Interning costs a hash computation and a table lookup for every new large type state. It can be
+ * disabled with {@link Options#InternTypeStateBitSets}.
+ */
+final class TypeStateBitSetInterner {
+    public static class Options {
+        @Option(help = "Share the type bit sets of equal multi-type states during points-to analysis.")//
+        public static final OptionKey<Boolean> InternTypeStateBitSets = new OptionKey<>(true);
+    }
+
+    /** The option value for the most recently seen options, so that it is not looked up again. */
+    private record EnabledFlag(OptionValues options, boolean enabled) {
+    }
+
+    private static volatile EnabledFlag enabledFlag;
+
+    private static final int STRIPES = 64;
+
+    @SuppressWarnings("unchecked") //
+    private static final WeakHashMap<BitSet, WeakReference<BitSet>>[] tables = new WeakHashMap[STRIPES];
+
+    static {
+        for (int i = 0; i < STRIPES; i++) {
+            tables[i] = new WeakHashMap<>();
+        }
+    }
+
+    private TypeStateBitSetInterner() {
+    }
+
+    static boolean isEnabled(OptionValues options) {
+        EnabledFlag flag = enabledFlag;
+        if (flag == null || flag.options() != options) {
+            flag = new EnabledFlag(options, Options.InternTypeStateBitSets.getValue(options));
+            enabledFlag = flag;
+        }
+        return flag.enabled();
+    }
+
+    /**
+     * Returns the canonical instance that is equal to {@code bitSet}. The bit set must not be
+     * modified after it was passed to this method.
+     */
+    static BitSet intern(BitSet bitSet) {
+        int hash = bitSet.hashCode();
+        WeakHashMap<BitSet, WeakReference<BitSet>> table = tables[(hash ^ (hash >>> 16)) & (STRIPES - 1)];
+        synchronized (table) {
+            WeakReference<BitSet> ref = table.get(bitSet);
+            BitSet canonical = ref == null ? null : ref.get();
+            if (canonical == null) {
+                table.put(bitSet, new WeakReference<>(bitSet));
+                canonical = bitSet;
+            }
+            return canonical;
+        }
+    }
+}
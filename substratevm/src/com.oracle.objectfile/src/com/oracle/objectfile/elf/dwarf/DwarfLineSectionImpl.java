@@ -28,7 +28,10 @@
 package com.oracle.objectfile.elf.dwarf;
 
 import java.util.Iterator;
+import java.util.List;
 import java.util.Map;
+import java.util.stream.Collectors;
+import java.util.stream.IntStream;
 
 import org.graalvm.compiler.debug.DebugContext;
 
@@ -165,21 +168,32 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
          * crop up inline-only but the tool still expects a line info entry to provide a file and
          * dir table.
          */
-        Cursor cursor = new Cursor();
-        instanceClassStream().forEach(classEntry -> {
+        List<ClassEntry> classEntries = instanceClassStream().collect(Collectors.toList());
+        int count = classEntries.size();
+        int[] prologueSizes = new int[count];
+        int[] totalSizes = new int[count];
+        /*
+         * Sizing a compile unit generates its line number table without a buffer. The state of the
+         * line number state machine is local to each table, so all units can be sized in parallel.
+         * Offsets are assigned afterwards in class order, so the layout is the same as when sizing
+         * sequentially.
+         */
+        IntStream.range(0, count).parallel().forEach(i -> {
+            ClassEntry classEntry = classEntries.get(i);
             assert classEntry.getFileName().length() != 0;
-            int startPos = cursor.get();
-            setLineIndex(classEntry, startPos);
-            int headerSize = headerSize();
-            int dirTableSize = computeDirTableSize(classEntry);
-            int fileTableSize = computeFileTableSize(classEntry);
-            int prologueSize = headerSize + dirTableSize + fileTableSize;
-            setLinePrologueSize(classEntry, prologueSize);
-            int lineNumberTableSize = computeLineNUmberTableSize(classEntry);
-            int totalSize = prologueSize + lineNumberTableSize;
-            setLineSectionSize(classEntry, totalSize);
-            cursor.add(totalSize);
+            int prologueSize = headerSize() + computeDirTableSize(classEntry) + computeFileTableSize(classEntry);
+            prologueSizes[i] = prologueSize;
+            totalSizes[i] = prologueSize + computeLineNUmberTableSize(classEntry);
         });
+
+        Cursor cursor = new Cursor();
+        for (int i = 0; i < count; i++) {
+            ClassEntry classEntry = classEntries.get(i);
+            setLineIndex(classEntry, cursor.get());
+            setLinePrologueSize(classEntry, prologueSizes[i]);
+            setLineSectionSize(classEntry, totalSizes[i]);
+            cursor.add(totalSizes[i]);
+        }
         byte[] buffer = new byte[cursor.get()];
         super.setContent(buffer);
     }
@@ -253,7 +267,7 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
             fileSize += length + 1;
             DirEntry dirEntry = localEntry.getDirEntry();
             int idx = classEntry.localDirsIdx(dirEntry);
-            fileSize += writeULEB(idx, scratch, 0);
+            fileSize += writeULEB(idx, null, 0);
             /*
              * The two zero timestamps require 1 byte each.
              */
@@ -274,6 +288,42 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return writeLineNumberTable(null, classEntry, null, 0);
     }
 
+    /*
+     * Compile units are sized in parallel, so sizing must not encode into the scratch buffer that
+     * is shared by all users of this section. Only the encoded length is needed anyway.
+     */
+
+    @Override
+    protected int writeULEB(long val, byte[] buffer, int p) {
+        if (buffer != null) {
+            return super.writeULEB(val, buffer, p);
+        }
+        int size = 0;
+        long v = val;
+        do {
+            v >>>= 7;
+            size++;
+        } while (v != 0);
+        return p + size;
+    }
+
+    @Override
+    protected int writeSLEB(long val, byte[] buffer, int p) {
+        if (buffer != null) {
+            return super.writeSLEB(val, buffer, p);
+        }
+        int size = 0;
+        long v = val;
+        boolean done;
+        do {
+            long b = v & 0x7f;
+            v >>= 7;
+            done = (v == 0 && (b & 0x40) == 0) || (v == -1 && (b & 0x40) != 0);
+            size++;
+        } while (!done);
+        return p + size;
+    }
+
     @Override
     public byte[] getOrDecideContent(Map<ObjectFile.Element, LayoutDecisionMap> alreadyDecided, byte[] contentHint) {
         ObjectFile.Element textElement = getElement().getOwner().elementForName(".text");
@@ -439,10 +489,22 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return pos;
     }
 
-    private long debugLine = 1;
-    private int debugCopyCount = 0;
+    /**
+     * The registers of the line number state machine while a line number table is generated. They
+     * are only used for logging. Each line number table gets its own instance, so that the tables
+     * of different class entries can be generated concurrently.
+     */
+    private static final class LineNumberState {
+        long address;
+        long line = 1;
+        int copyCount = 0;
+
+        LineNumberState(long address) {
+            this.address = address;
+        }
+    }
 
-    private int writeCompiledMethodLineInfo(DebugContext context, ClassEntry classEntry, CompiledMethodEntry compiledEntry, byte[] buffer, int p) {
+    private int writeCompiledMethodLineInfo(DebugContext context, LineNumberState state, ClassEntry classEntry, CompiledMethodEntry compiledEntry, byte[] buffer, int p) {
         int pos = p;
         Range primaryRange = compiledEntry.getPrimary();
         // the compiled method might be a substitution and not in the file of the class entry
@@ -493,14 +555,14 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         /*
          * Address is currently at offset 0.
          */
-        pos = writeSetAddressOp(context, address, buffer, pos);
+        pos = writeSetAddressOp(context, state, address, buffer, pos);
         /*
          * State machine value of line is currently 1 increment to desired line.
          */
         if (line != 1) {
-            pos = writeAdvanceLineOp(context, line - 1, buffer, pos);
+            pos = writeAdvanceLineOp(context, state, line - 1, buffer, pos);
         }
-        pos = writeCopyOp(context, buffer, pos);
+        pos = writeCopyOp(context, state, buffer, pos);
 
         /*
          * Now write a row for each subrange lo and hi.
@@ -564,7 +626,7 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
                  * Ignore pointless write when addressDelta == lineDelta == 0.
                  */
                 if (addressDelta != 0 || lineDelta != 0) {
-                    pos = writeSpecialOpcode(context, opcode, buffer, pos);
+                    pos = writeSpecialOpcode(context, state, opcode, buffer, pos);
                 }
             } else {
                 /*
@@ -572,7 +634,7 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
                  */
                 int remainder = isConstAddPC(addressDelta);
                 if (remainder > 0) {
-                    pos = writeConstAddPCOp(context, buffer, pos);
+                    pos = writeConstAddPCOp(context, state, buffer, pos);
                     /*
                      * The remaining address can be handled with a special opcode but what about the
                      * line delta.
@@ -582,7 +644,7 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
                         /*
                          * Address remainder and line now fit.
                          */
-                        pos = writeSpecialOpcode(context, opcode, buffer, pos);
+                        pos = writeSpecialOpcode(context, state, opcode, buffer, pos);
                     } else {
                         /*
                          * Ok, bump the line separately then use a special opcode for the address
@@ -590,15 +652,15 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
                          */
                         opcode = isSpecialOpcode(remainder, 0);
                         assert opcode != DW_LNS_undefined;
-                        pos = writeAdvanceLineOp(context, lineDelta, buffer, pos);
-                        pos = writeSpecialOpcode(context, opcode, buffer, pos);
+                        pos = writeAdvanceLineOp(context, state, lineDelta, buffer, pos);
+                        pos = writeSpecialOpcode(context, state, opcode, buffer, pos);
                     }
                 } else {
                     /*
                      * Increment line and pc separately.
                      */
                     if (lineDelta != 0) {
-                        pos = writeAdvanceLineOp(context, lineDelta, buffer, pos);
+                        pos = writeAdvanceLineOp(context, state, lineDelta, buffer, pos);
                     }
                     /*
                      * n.b. we might just have had an out of range line increment with a zero
@@ -609,12 +671,12 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
                          * See if we can use a ushort for the increment.
                          */
                         if (isFixedAdvancePC(addressDelta)) {
-                            pos = writeFixedAdvancePCOp(context, (short) addressDelta, buffer, pos);
+                            pos = writeFixedAdvancePCOp(context, state, (short) addressDelta, buffer, pos);
                         } else {
-                            pos = writeAdvancePCOp(context, addressDelta, buffer, pos);
+                            pos = writeAdvancePCOp(context, state, addressDelta, buffer, pos);
                         }
                     }
-                    pos = writeCopyOp(context, buffer, pos);
+                    pos = writeCopyOp(context, state, buffer, pos);
                 }
             }
             /*
@@ -631,9 +693,9 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
             /*
              * Increment address before we write the end sequence.
              */
-            pos = writeAdvancePCOp(context, addressDelta, buffer, pos);
+            pos = writeAdvancePCOp(context, state, addressDelta, buffer, pos);
         }
-        pos = writeEndSequenceOp(context, buffer, pos);
+        pos = writeEndSequenceOp(context, state, buffer, pos);
 
         return pos;
     }
@@ -649,9 +711,10 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         String classLabel = classEntry.hasCompiledEntries() ? "compiled class" : "non-compiled class";
         log(context, "  [0x%08x] %s %s", pos, classLabel, className);
         log(context, "  [0x%08x] %s file %s", pos, className, fileName);
+        LineNumberState state = new LineNumberState(debugTextBase);
         // generate for both non-deopt and deopt entries so they share the file + dir table
         pos = classEntry.compiledEntries().reduce(pos,
-                        (p1, compiledEntry) -> writeCompiledMethodLineInfo(context, classEntry, compiledEntry, buffer, p1),
+                        (p1, compiledEntry) -> writeCompiledMethodLineInfo(context, state, classEntry, compiledEntry, buffer, p1),
                         (oldPos, newPos) -> newPos);
         log(context, "  [0x%08x] processed %s %s", pos, classLabel, className);
 
@@ -669,28 +732,28 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return null;
     }
 
-    private int writeCopyOp(DebugContext context, byte[] buffer, int p) {
+    private int writeCopyOp(DebugContext context, LineNumberState state, byte[] buffer, int p) {
         byte opcode = DW_LNS_copy;
         int pos = p;
-        debugCopyCount++;
-        verboseLog(context, "  [0x%08x] Copy %d", pos, debugCopyCount);
+        state.copyCount++;
+        verboseLog(context, "  [0x%08x] Copy %d", pos, state.copyCount);
         return writeByte(opcode, buffer, pos);
     }
 
-    private int writeAdvancePCOp(DebugContext context, long uleb, byte[] buffer, int p) {
+    private int writeAdvancePCOp(DebugContext context, LineNumberState state, long uleb, byte[] buffer, int p) {
         byte opcode = DW_LNS_advance_pc;
         int pos = p;
-        debugAddress += uleb;
-        verboseLog(context, "  [0x%08x] Advance PC by %d to 0x%08x", pos, uleb, debugAddress);
+        state.address += uleb;
+        verboseLog(context, "  [0x%08x] Advance PC by %d to 0x%08x", pos, uleb, state.address);
         pos = writeByte(opcode, buffer, pos);
         return writeULEB(uleb, buffer, pos);
     }
 
-    private int writeAdvanceLineOp(DebugContext context, long sleb, byte[] buffer, int p) {
+    private int writeAdvanceLineOp(DebugContext context, LineNumberState state, long sleb, byte[] buffer, int p) {
         byte opcode = DW_LNS_advance_line;
         int pos = p;
-        debugLine += sleb;
-        verboseLog(context, "  [0x%08x] Advance Line by %d to %d", pos, sleb, debugLine);
+        state.line += sleb;
+        verboseLog(context, "  [0x%08x] Advance Line by %d to %d", pos, sleb, state.line);
         pos = writeByte(opcode, buffer, pos);
         return writeSLEB(sleb, buffer, pos);
     }
@@ -725,31 +788,31 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return writeByte(opcode, buffer, pos);
     }
 
-    private int writeConstAddPCOp(DebugContext context, byte[] buffer, int p) {
+    private int writeConstAddPCOp(DebugContext context, LineNumberState state, byte[] buffer, int p) {
         byte opcode = DW_LNS_const_add_pc;
         int pos = p;
         int advance = opcodeAddress((byte) 255);
-        debugAddress += advance;
-        verboseLog(context, "  [0x%08x] Advance PC by constant %d to 0x%08x", pos, advance, debugAddress);
+        state.address += advance;
+        verboseLog(context, "  [0x%08x] Advance PC by constant %d to 0x%08x", pos, advance, state.address);
         return writeByte(opcode, buffer, pos);
     }
 
-    private int writeFixedAdvancePCOp(DebugContext context, short arg, byte[] buffer, int p) {
+    private int writeFixedAdvancePCOp(DebugContext context, LineNumberState state, short arg, byte[] buffer, int p) {
         byte opcode = DW_LNS_fixed_advance_pc;
         int pos = p;
-        debugAddress += arg;
-        verboseLog(context, "  [0x%08x] Fixed advance Address by %d to 0x%08x", pos, arg, debugAddress);
+        state.address += arg;
+        verboseLog(context, "  [0x%08x] Fixed advance Address by %d to 0x%08x", pos, arg, state.address);
         pos = writeByte(opcode, buffer, pos);
         return writeShort(arg, buffer, pos);
     }
 
-    private int writeEndSequenceOp(DebugContext context, byte[] buffer, int p) {
+    private int writeEndSequenceOp(DebugContext context, LineNumberState state, byte[] buffer, int p) {
         byte opcode = DW_LNE_end_sequence;
         int pos = p;
         verboseLog(context, "  [0x%08x] Extended opcode 1: End sequence", pos);
-        debugAddress = debugTextBase;
-        debugLine = 1;
-        debugCopyCount = 0;
+        state.address = debugTextBase;
+        state.line = 1;
+        state.copyCount = 0;
         pos = writeByte(DW_LNS_extended_prefix, buffer, pos);
         /*
          * Insert extended insn byte count as ULEB.
@@ -758,11 +821,11 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return writeByte(opcode, buffer, pos);
     }
 
-    private int writeSetAddressOp(DebugContext context, long arg, byte[] buffer, int p) {
+    private int writeSetAddressOp(DebugContext context, LineNumberState state, long arg, byte[] buffer, int p) {
         byte opcode = DW_LNE_set_address;
         int pos = p;
-        debugAddress = debugTextBase + (int) arg;
-        verboseLog(context, "  [0x%08x] Extended opcode 2: Set Address to 0x%08x", pos, debugAddress);
+        state.address = debugTextBase + (int) arg;
+        verboseLog(context, "  [0x%08x] Extended opcode 2: Set Address to 0x%08x", pos, state.address);
         pos = writeByte(DW_LNS_extended_prefix, buffer, pos);
         /*
          * Insert extended insn byte count as ULEB.
@@ -782,9 +845,9 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         int fileBytes = countUTF8Bytes(file) + 1;
         long insnBytes = 1;
         insnBytes += fileBytes;
-        insnBytes += writeULEB(uleb1, scratch, 0);
-        insnBytes += writeULEB(uleb2, scratch, 0);
-        insnBytes += writeULEB(uleb3, scratch, 0);
+        insnBytes += writeULEB(uleb1, null, 0);
+        insnBytes += writeULEB(uleb2, null, 0);
+        insnBytes += writeULEB(uleb3, null, 0);
         verboseLog(context, "  [0x%08x] Extended opcode 3: Define File %s idx %d ts1 %d ts2 %d", pos, file, uleb1, uleb2, uleb3);
         pos = writeByte(DW_LNS_extended_prefix, buffer, pos);
         /*
@@ -816,15 +879,15 @@ public class DwarfLineSectionImpl extends DwarfSectionImpl {
         return ((iopcode - DW_LN_OPCODE_BASE) % DW_LN_LINE_RANGE) + DW_LN_LINE_BASE;
     }
 
-    private int writeSpecialOpcode(DebugContext context, byte opcode, byte[] buffer, int p) {
+    private int writeSpecialOpcode(DebugContext context, LineNumberState state, byte opcode, byte[] buffer, int p) {
         int pos = p;
         if (debug && opcode == 0) {
-            verboseLog(context, "  [0x%08x] ERROR Special Opcode %d: Address 0x%08x Line %d", debugAddress, debugLine);
+            verboseLog(context, "  [0x%08x] ERROR Special Opcode %d: Address 0x%08x Line %d", state.address, state.line);
         }
-        debugAddress += opcodeAddress(opcode);
-        debugLine += opcodeLine(opcode);
+        state.address += opcodeAddress(opcode);
+        state.line += opcodeLine(opcode);
         verboseLog(context, "  [0x%08x] Special Opcode %d: advance Address by %d to 0x%08x and Line by %d to %d",
-                        pos, opcodeId(opcode), opcodeAddress(opcode), debugAddress, opcodeLine(opcode), debugLine);
+                        pos, opcodeId(opcode), opcodeAddress(opcode), state.address, opcodeLine(opcode), state.line);
         return writeByte(opcode, buffer, pos);
     }
 
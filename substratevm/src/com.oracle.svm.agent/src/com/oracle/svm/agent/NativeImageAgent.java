@@ -151,6 +151,7 @@ public final class NativeImageAgent extends JvmtiAgentBase<NativeImageAgentJNIHa
         int configWritePeriod = -1; // in seconds
         int configWritePeriodInitialDelay = 1; // in seconds
         boolean trackReflectionMetadata = true;
+        boolean deduplicateEvents = false;
 
         String[] tokens = !options.isEmpty() ? options.split(",") : new String[0];
         for (String token : tokens) {
@@ -218,6 +219,8 @@ public final class NativeImageAgent extends JvmtiAgentBase<NativeImageAgentJNIHa
                 conditionalConfigPartialRun = getBooleanTokenValue(token);
             } else if (isBooleanOption(token, "track-reflection-metadata")) {
                 trackReflectionMetadata = getBooleanTokenValue(token);
+            } else if (isBooleanOption(token, "experimental-deduplicate-events")) {
+                deduplicateEvents = getBooleanTokenValue(token);
             } else {
                 return usage(1, "unknown option: '" + token + "'.");
             }
@@ -377,6 +380,10 @@ public final class NativeImageAgent extends JvmtiAgentBase<NativeImageAgentJNIHa
             }
         }
 
+        if (deduplicateEvents && tracer != null) {
+            tracer.enableEventDeduplication();
+        }
+
         if (build) {
             int status = buildImage(jvmti);
             if (status == 0) {
@@ -26,6 +26,9 @@
 package com.oracle.svm.agent.tracing.core;
 
 import java.util.Arrays;
+import java.util.HashSet;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
 
 import org.graalvm.collections.EconomicMap;
 
@@ -38,6 +41,68 @@ public abstract class Tracer {
     /** Value to express an unknown value, for example on failure to retrieve the value. */
     public static final String UNKNOWN_VALUE = new String("\0");
 
+    /** Bound for the per-thread sets of {@link #enableEventDeduplication deduplication}. */
+    private static final int MAX_EVENTS_PER_THREAD = 4096;
+
+    private volatile String phase = "";
+    private Set<String> tracedEvents;
+    private ThreadLocal<Set<String>> tracedEventsOfThread;
+
+    /**
+     * Drops calls that are identical to a call that was already traced in the same phase, before
+     * they are converted to trace entries. Repeated reflective and JNI accesses are very common
+     * (e.g., in loops and in test suites), but they never add new information to the trace or the
+     * configuration. Calls with a stack trace are never dropped because their origins may differ.
+     *
+     * Each thread first checks a small set of its own events without any synchronization, so that
+     * hot call sites do not contend on the shared set of all traced events.
+     */
+    public void enableEventDeduplication() {
+        tracedEvents = ConcurrentHashMap.newKeySet();
+        tracedEventsOfThread = ThreadLocal.withInitial(HashSet::new);
+    }
+
+    private boolean isDuplicate(String tracer, String function, Object clazz, Object declaringClass, Object callerClass, Object result, Object[] args) {
+        StringBuilder key = new StringBuilder(phase);
+        appendKey(key, tracer);
+        appendKey(key, function);
+        appendKey(key, clazz);
+        appendKey(key, declaringClass);
+        appendKey(key, callerClass);
+        appendKey(key, result);
+        appendKey(key, args);
+        String event = key.toString();
+
+        Set<String> threadEvents = tracedEventsOfThread.get();
+        if (threadEvents.contains(event)) {
+            return true;
+        }
+        if (threadEvents.size() >= MAX_EVENTS_PER_THREAD) {
+            threadEvents.clear();
+        }
+        threadEvents.add(event);
+        return !tracedEvents.add(event);
+    }
+
+    private static void appendKey(StringBuilder key, Object value) {
+        key.append('\u0001');
+        if (value == EXPLICIT_NULL) {
+            key.append("\u0002null");
+        } else if (value == UNKNOWN_VALUE) {
+            key.append("\u0002unknown");
+        } else if (value instanceof Object[]) {
+            key.append('[');
+            for (Object element : (Object[]) value) {
+                appendKey(key, element);
+            }
+            key.append(']');
+        } else if (value == null) {
+            key.append('\u0003');
+        } else {
+            key.append(value);
+        }
+    }
+
     protected static Object handleSpecialValue(Object obj) {
         if (obj == EXPLICIT_NULL) {
             return null;
@@ -68,6 +133,7 @@ public abstract class Tracer {
     }
 
     public void tracePhaseChange(String phase) {
+        this.phase = phase;
         EconomicMap<String, Object> entry = EconomicMap.create();
         entry.put("tracer", "meta");
         entry.put("event", "phase_change");
@@ -94,6 +160,9 @@ public abstract class Tracer {
      * @param args Arguments to the call, which may contain arrays (which can contain more arrays)
      */
     public void traceCall(String tracer, String function, Object clazz, Object declaringClass, Object callerClass, Object result, JNIMethodId[] stackTrace, Object... args) {
+        if (tracedEvents != null && stackTrace == null && isDuplicate(tracer, function, clazz, declaringClass, callerClass, result, args)) {
+            return;
+        }
         EconomicMap<String, Object> entry = EconomicMap.create();
         entry.put("tracer", tracer);
         entry.put("function", function);
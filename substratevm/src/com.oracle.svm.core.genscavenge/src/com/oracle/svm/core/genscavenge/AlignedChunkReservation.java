@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.genscavenge;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.compiler.options.Option;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+import org.graalvm.word.Pointer;
+import org.graalvm.word.UnsignedWord;
+import org.graalvm.word.WordFactory;
+
+import com.oracle.svm.core.SubstrateOptions;
+import com.oracle.svm.core.Uninterruptible;
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.genscavenge.AlignedHeapChunk.AlignedHeader;
+import com.oracle.svm.core.jdk.RuntimeSupport;
+import com.oracle.svm.core.jdk.UninterruptibleUtils;
+import com.oracle.svm.core.jdk.UninterruptibleUtils.AtomicUnsigned;
+import com.oracle.svm.core.option.RuntimeOptionKey;
+import com.oracle.svm.core.os.TransparentHugePageSupport;
+import com.oracle.svm.core.os.VirtualMemoryProvider;
+import com.oracle.svm.core.util.UnsignedUtils;
+
+/**
+ * A contiguous address range for aligned chunks that is committed once at startup. Unlike chunks
+ * that are committed one by one, the range can be backed by transparent huge pages as a whole and
+ * it can be pre-touched in parallel before the application starts allocating. The range covers the
+ * maximum young generation size. Chunks from the range are never returned to the operating system
+ * before the isolate is torn down, and chunks beyond the range are still committed one by one.
+ */
+final class AlignedChunkReservation {
+    public static class Options {
+        @Option(help = "Advise the OS to back the young generation with transparent huge pages, where available.")//
+        public static final RuntimeOptionKey<Boolean> UseTransparentHugePages = new RuntimeOptionKey<>(false, RuntimeOptionKey.RuntimeOptionKeyFlag.Immutable);
+
+        @Option(help = "Touch all pages of the young generation at startup, so that no page faults occur during allocation.")//
+        public static final RuntimeOptionKey<Boolean> AlwaysPreTouch = new RuntimeOptionKey<>(false, RuntimeOptionKey.RuntimeOptionKeyFlag.Immutable);
+    }
+
+    /** Start of the range, or null if the range was not (yet) committed. */
+    private Pointer start;
+    private UnsignedWord size;
+    /** The number of bytes at the start of the range that were already handed out as chunks. */
+    private final AtomicUnsigned used = new AtomicUnsigned();
+    /** Chunks from the range that were freed, chained using {@link HeapChunk#getNext}. */
+    private final UninterruptibleUtils.AtomicPointer<AlignedHeader> freeChunks = new UninterruptibleUtils.AtomicPointer<>();
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    AlignedChunkReservation() {
+    }
+
+    @Fold
+    static AlignedChunkReservation singleton() {
+        return ImageSingletons.lookup(AlignedChunkReservation.class);
+    }
+
+    static boolean isEnabled() {
+        return Options.UseTransparentHugePages.getValue() || Options.AlwaysPreTouch.getValue();
+    }
+
+    /**
+     * Reserves and commits the range. If that fails, the young generation is simply committed chunk
+     * by chunk as without this reservation.
+     */
+    void initialize() {
+        assert start.isNull();
+        UnsignedWord chunkSize = HeapParameters.getAlignedHeapChunkSize();
+        UnsignedWord nbytes = UnsignedUtils.roundUp(GCImpl.getPolicy().getMaximumYoungGenerationSize(), chunkSize);
+        if (nbytes.equal(0)) {
+            return;
+        }
+
+        VirtualMemoryProvider memory = VirtualMemoryProvider.get();
+        Pointer result = memory.reserve(nbytes, HeapParameters.getAlignedHeapChunkAlignment(), false);
+        if (result.isNull()) {
+            return;
+        }
+        if (memory.commit(result, nbytes, VirtualMemoryProvider.Access.READ | VirtualMemoryProvider.Access.WRITE).isNull()) {
+            memory.free(result, nbytes);
+            return;
+        }
+
+        if (Options.UseTransparentHugePages.getValue() && TransparentHugePageSupport.isSupported()) {
+            /* Failing is fine, the range is then backed by regular pages. */
+            TransparentHugePageSupport.get().adviseHugePages(result, nbytes);
+        }
+        if (Options.AlwaysPreTouch.getValue()) {
+            /* Must happen before the range is published, because touching writes to it. */
+            PreTouchThread.preTouch(result, nbytes.unsignedDivide(chunkSize));
+        }
+
+        size = nbytes;
+        start = result;
+    }
+
+    /** Returns a chunk from the range, or null if the range is exhausted or not committed. */
+    @Uninterruptible(reason = "Must not be interrupted by competing pushes.")
+    Pointer allocateChunk() {
+        if (start.isNull()) {
+            return WordFactory.nullPointer();
+        }
+
+        while (true) {
+            AlignedHeader chunk = freeChunks.get();
+            if (chunk.isNull()) {
+                break;
+            }
+            if (freeChunks.compareAndSet(chunk, HeapChunk.getNext(chunk))) {
+                HeapChunk.setNext(chunk, WordFactory.nullPointer());
+                return (Pointer) chunk;
+            }
+        }
+
+        UnsignedWord chunkSize = HeapParameters.getAlignedHeapChunkSize();
+        while (true) {
+            UnsignedWord offset = used.get();
+            if (offset.add(chunkSize).aboveThan(size)) {
+                return WordFactory.nullPointer();
+            }
+            if (used.compareAndSet(offset, offset.add(chunkSize))) {
+                return start.add(offset);
+            }
+        }
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    boolean contains(AlignedHeader chunk) {
+        return start.isNonNull() && ((Pointer) chunk).aboveOrEqual(start) && ((Pointer) chunk).belowThan(start.add(size));
+    }
+
+    /**
+     * Keeps a chunk of the range for reuse. Like pushes to the unused chunk list of the
+     * {@link HeapChunkProvider}, this is only done during a garbage collection or at tear-down, so
+     * it cannot race with {@link #allocateChunk}.
+     */
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    void freeChunk(AlignedHeader chunk) {
+        assert contains(chunk);
+        HeapChunk.setNext(chunk, freeChunks.get());
+        freeChunks.set(chunk);
+    }
+
+    /** Must be called after all chunks of the range were freed, because they are linked in it. */
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    void tearDown() {
+        if (start.isNonNull()) {
+            VirtualMemoryProvider.get().free(start, size);
+            start = WordFactory.nullPointer();
+        }
+    }
+
+    /** Touches a share of the chunks of the range. */
+    private static final class PreTouchThread extends Thread {
+        private final long rangeStart;
+        private final long firstChunk;
+        private final long endChunk;
+
+        PreTouchThread(long rangeStart, long firstChunk, long endChunk) {
+            super("Pre-touch young generation");
+            this.rangeStart = rangeStart;
+            this.firstChunk = firstChunk;
+            this.endChunk = endChunk;
+        }
+
+        static void preTouch(Pointer rangeStart, UnsignedWord chunkCount) {
+            long chunks = chunkCount.rawValue();
+            int threadCount = (int) Math.max(1, Math.min(Runtime.getRuntime().availableProcessors(), chunks));
+            PreTouchThread[] threads = new PreTouchThread[threadCount];
+            for (int i = 0; i < threadCount; i++) {
+                threads[i] = new PreTouchThread(rangeStart.rawValue(), chunks * i / threadCount, chunks * (i + 1) / threadCount);
+            }
+            /* The current thread takes the first share instead of waiting idly. */
+            for (int i = 1; i < threadCount; i++) {
+                threads[i].start();
+            }
+            threads[0].run();
+            for (int i = 1; i < threadCount; i++) {
+                joinUninterruptibly(threads[i]);
+            }
+        }
+
+        private static void joinUninterruptibly(Thread thread) {
+            boolean interrupted = false;
+            while (true) {
+                try {
+                    thread.join();
+                    break;
+                } catch (InterruptedException e) {
+                    interrupted = true;
+                }
+            }
+            if (interrupted) {
+                Thread.currentThread().interrupt();
+            }
+        }
+
+        /**
+         * The memory was just committed and is zeroed, so writing zero does not change its
+         * contents.
+         */
+        @Override
+        public void run() {
+            UnsignedWord chunkSize = HeapParameters.getAlignedHeapChunkSize();
+            UnsignedWord pageSize = VirtualMemoryProvider.get().getGranularity();
+            Pointer begin = WordFactory.pointer(rangeStart + chunkSize.rawValue() * firstChunk);
+            Pointer end = WordFactory.pointer(rangeStart + chunkSize.rawValue() * endChunk);
+            for (Pointer p = begin; p.belowThan(end); p = p.add(pageSize)) {
+                p.writeWord(0, WordFactory.zero());
+            }
+        }
+    }
+}
+
+@AutomaticallyRegisteredFeature
+class AlignedChunkReservationFeature implements InternalFeature {
+    @Override
+    public boolean isInConfiguration(IsInConfigurationAccess access) {
+        return SubstrateOptions.UseSerialGC.getValue();
+    }
+
+    @Override
+    public void beforeAnalysis(BeforeAnalysisAccess access) {
+        ImageSingletons.add(AlignedChunkReservation.class, new AlignedChunkReservation());
+        RuntimeSupport.getRuntimeSupport().addStartupHook(isFirstIsolate -> {
+            if (AlignedChunkReservation.isEnabled()) {
+                AlignedChunkReservation.singleton().initialize();
+            }
+        });
+    }
+}
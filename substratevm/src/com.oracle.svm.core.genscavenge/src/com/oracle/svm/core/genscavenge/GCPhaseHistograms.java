@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.genscavenge;
+
+import java.util.Arrays;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+
+import com.oracle.svm.core.Uninterruptible;
+
+/**
+ * Fixed-bucket latency histograms for the GC phases that are measured by a {@link Timer}. Bucket
+ * {@code 0} counts all pauses shorter than {@code 2^FIRST_BUCKET_SHIFT} nanoseconds (16us), every
+ * following bucket covers four times the range of its predecessor, and the last bucket (17s and
+ * more) is open-ended. Recording a pause is therefore just a leading-zero count and an increment,
+ * which is cheap enough to always be enabled.
+ *
+ * The histograms are only written by the GC, i.e., within a safepoint. Readers such as the
+ * jvmstat sampling thread may see a partially updated histogram but never a torn value.
+ */
+public final class GCPhaseHistograms {
+    public static final int BUCKET_COUNT = 12;
+    public static final int FIRST_BUCKET_SHIFT = 14;
+    /** Each bucket limit is {@code 2^BUCKET_SHIFT} times the previous one. */
+    public static final int BUCKET_SHIFT = 2;
+
+    private PhaseHistogram[] histograms = new PhaseHistogram[0];
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    GCPhaseHistograms() {
+    }
+
+    @Fold
+    public static GCPhaseHistograms singleton() {
+        return ImageSingletons.lookup(GCPhaseHistograms.class);
+    }
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    static synchronized PhaseHistogram register(String name) {
+        if (!ImageSingletons.contains(GCPhaseHistograms.class)) {
+            ImageSingletons.add(GCPhaseHistograms.class, new GCPhaseHistograms());
+        }
+        GCPhaseHistograms singleton = ImageSingletons.lookup(GCPhaseHistograms.class);
+        PhaseHistogram result = new PhaseHistogram(name);
+        singleton.histograms = Arrays.copyOf(singleton.histograms, singleton.histograms.length + 1);
+        singleton.histograms[singleton.histograms.length - 1] = result;
+        return result;
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    public int getCount() {
+        return histograms.length;
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    public PhaseHistogram get(int index) {
+        return histograms[index];
+    }
+
+    /** Returns the exclusive upper bound of the given bucket, or -1 for the last bucket. */
+    public static long getBucketLimitNanos(int bucket) {
+        if (bucket == BUCKET_COUNT - 1) {
+            return -1;
+        }
+        return 1L << (FIRST_BUCKET_SHIFT + BUCKET_SHIFT * bucket);
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    static int getBucket(long nanos) {
+        int bits = Long.SIZE - Long.numberOfLeadingZeros(nanos >>> FIRST_BUCKET_SHIFT);
+        int bucket = (bits + BUCKET_SHIFT - 1) / BUCKET_SHIFT;
+        return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+    }
+
+    public static final class PhaseHistogram {
+        private final String name;
+        private final long[] buckets;
+        private long totalCount;
+        private long maxNanos;
+
+        @Platforms(Platform.HOSTED_ONLY.class)
+        PhaseHistogram(String name) {
+            this.name = name;
+            this.buckets = new long[BUCKET_COUNT];
+        }
+
+        @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+        public String getName() {
+            return name;
+        }
+
+        @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+        public long getBucketValue(int bucket) {
+            return buckets[bucket];
+        }
+
+        public long getTotalCount() {
+            return totalCount;
+        }
+
+        public long getMaxNanos() {
+            return maxNanos;
+        }
+
+        @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+        void record(long durationNanos) {
+            buckets[getBucket(durationNanos)]++;
+            totalCount++;
+            if (durationNanos > maxNanos) {
+                maxNanos = durationNanos;
+            }
+        }
+    }
+}
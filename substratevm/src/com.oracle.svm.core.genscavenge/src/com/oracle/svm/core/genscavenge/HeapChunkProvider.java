@@ -56,6 +56,9 @@ import com.oracle.svm.core.util.UnsignedUtils;
  * Memory for aligned chunks is not immediately released to the OS. Chunks with a total of up to
  * {@link CollectionPolicy#getMaximumFreeAlignedChunksSize()} bytes are saved in an unused chunk
  * list. Memory for unaligned chunks is released immediately.
+ *
+ * If an {@link AlignedChunkReservation} was committed at startup, aligned chunks are taken from it
+ * before new memory is requested from the operating system.
  */
 final class HeapChunkProvider {
     /**
@@ -110,7 +113,10 @@ final class HeapChunkProvider {
         if (result.isNull()) {
             /* Unused list was empty, need to allocate memory. */
             noteFirstAllocationTime();
-            result = (AlignedHeader) CommittedMemoryProvider.get().allocateAlignedChunk(chunkSize, HeapParameters.getAlignedHeapChunkAlignment());
+            result = (AlignedHeader) AlignedChunkReservation.singleton().allocateChunk();
+            if (result.isNull()) {
+                result = (AlignedHeader) CommittedMemoryProvider.get().allocateAlignedChunk(chunkSize, HeapParameters.getAlignedHeapChunkAlignment());
+            }
             if (result.isNull()) {
                 throw OutOfMemoryUtil.reportOutOfMemoryError(ALIGNED_OUT_OF_MEMORY_ERROR);
             }
@@ -343,9 +349,11 @@ final class HeapChunkProvider {
         return firstAllocationTime;
     }
 
+    /** Must be called after the spaces were torn down, because it releases the reserved range. */
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
     void tearDown() {
         freeAlignedChunkList(unusedAlignedChunks.get());
+        AlignedChunkReservation.singleton().tearDown();
     }
 
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
@@ -368,6 +376,11 @@ final class HeapChunkProvider {
 
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
     private static void freeAlignedChunk(AlignedHeader chunk) {
+        AlignedChunkReservation reservation = AlignedChunkReservation.singleton();
+        if (reservation.contains(chunk)) {
+            reservation.freeChunk(chunk);
+            return;
+        }
         CommittedMemoryProvider.get().freeAlignedChunk(chunk, HeapParameters.getAlignedHeapChunkSize(), HeapParameters.getAlignedHeapChunkAlignment());
     }
 
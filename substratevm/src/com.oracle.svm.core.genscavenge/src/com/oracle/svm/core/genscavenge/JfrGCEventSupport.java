@@ -85,15 +85,30 @@ class JfrGCEventSupport {
 
     @Uninterruptible(reason = "Accesses a JFR buffer.")
     public void emitGCPhasePauseEvent(UnsignedWord gcEpoch, int level, String name, long startTicks) {
+        emitGCPhasePauseEvent0(gcEpoch, level, name, startTicks, JfrTicks.elapsedTicks() - startTicks);
+    }
+
+    /**
+     * Emits a GCPhasePause event for a {@link Timer GC phase} that was measured with
+     * {@link System#nanoTime()}.
+     */
+    @Uninterruptible(reason = "Accesses a JFR buffer.")
+    public void emitGCPhasePauseEvent(UnsignedWord gcEpoch, int level, String name, long startNanos, long endNanos) {
+        /* Both clocks are based on System.nanoTime(), so only the origin differs. */
+        long ticksOffset = JfrTicks.elapsedTicks() - System.nanoTime();
+        emitGCPhasePauseEvent0(gcEpoch, level, name, startNanos + ticksOffset, endNanos - startNanos);
+    }
+
+    @Uninterruptible(reason = "Accesses a JFR buffer.")
+    private static void emitGCPhasePauseEvent0(UnsignedWord gcEpoch, int level, String name, long startTicks, long durationTicks) {
         JfrEvent event = getGCPhasePauseEvent(level);
         if (event.shouldEmit()) {
-            long end = JfrTicks.elapsedTicks();
             JfrNativeEventWriterData data = StackValue.get(JfrNativeEventWriterData.class);
             JfrNativeEventWriterDataAccess.initializeThreadLocalNativeBuffer(data);
 
             JfrNativeEventWriter.beginSmallEvent(data, event);
             JfrNativeEventWriter.putLong(data, startTicks);
-            JfrNativeEventWriter.putLong(data, end - startTicks);
+            JfrNativeEventWriter.putLong(data, durationTicks);
             JfrNativeEventWriter.putEventThread(data);
             JfrNativeEventWriter.putLong(data, gcEpoch.rawValue());
             JfrNativeEventWriter.putString(data, name);
@@ -132,6 +132,7 @@ final class ReferenceObjectProcessing {
                 // Important: we need to pass the reference object as holder so that the remembered
                 // set can be updated accordingly!
                 refVisitor.visitObjectReference(ReferenceInternals.getReferentFieldAddress(dr), true, dr);
+                ReferenceProcessingStatistics.get().noteSoftKeptAlive();
                 return; // referent will survive and referent field has been updated
             }
         }
@@ -144,6 +145,7 @@ final class ReferenceObjectProcessing {
         Reference<?> next = (rememberedRefsList != null) ? rememberedRefsList : dr;
         ReferenceInternals.setNextDiscovered(dr, next);
         rememberedRefsList = dr;
+        ReferenceProcessingStatistics.get().noteRemembered();
     }
 
     /**
@@ -168,6 +170,7 @@ final class ReferenceObjectProcessing {
                 // by the reference handler.
                 ReferenceInternals.setNextDiscovered(current, pendingHead);
                 pendingHead = current;
+                ReferenceProcessingStatistics.get().notePending();
             } else {
                 // No need to enqueue this reference.
                 ReferenceInternals.setNextDiscovered(current, null);
@@ -214,6 +217,7 @@ final class ReferenceObjectProcessing {
          * barrier for this store.
          */
         ReferenceInternals.setReferent(dr, null);
+        ReferenceProcessingStatistics.get().noteCleared();
         return false;
     }
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.genscavenge;
+
+import java.lang.ref.Reference;
+
+/**
+ * Cumulative counts of the {@link Reference} objects that {@link ReferenceObjectProcessing}
+ * handled, so that the cost of reference processing can be related to the pause times of the
+ * {@code referenceObjects} phase. The counters are only updated by the GC.
+ */
+public final class ReferenceProcessingStatistics {
+    private static final ReferenceProcessingStatistics INSTANCE = new ReferenceProcessingStatistics();
+
+    /** References that could not be resolved during discovery and had to be revisited. */
+    private long remembered;
+    /** Soft references whose referents were kept alive during discovery. */
+    private long softKeptAlive;
+    /** References whose referents did not survive and were cleared. */
+    private long cleared;
+    /** Cleared references that were handed to the reference handler for enqueueing. */
+    private long pending;
+
+    private ReferenceProcessingStatistics() {
+    }
+
+    public static ReferenceProcessingStatistics get() {
+        return INSTANCE;
+    }
+
+    public long getRemembered() {
+        return remembered;
+    }
+
+    public long getSoftKeptAlive() {
+        return softKeptAlive;
+    }
+
+    public long getCleared() {
+        return cleared;
+    }
+
+    public long getPending() {
+        return pending;
+    }
+
+    void noteRemembered() {
+        remembered++;
+    }
+
+    void noteSoftKeptAlive() {
+        softKeptAlive++;
+    }
+
+    void noteCleared() {
+        cleared++;
+    }
+
+    void notePending() {
+        pending++;
+    }
+}
@@ -25,22 +25,37 @@
  */
 package com.oracle.svm.core.genscavenge;
 
+import org.graalvm.nativeimage.ImageSingletons;
+
+import com.oracle.svm.core.SubstrateUtil;
+import com.oracle.svm.core.jfr.HasJfrSupport;
 import com.oracle.svm.core.log.Log;
 
 /**
  * A single wall-clock stopwatch that can be repeatedly {@linkplain #open started} and
- * {@linkplain #close() stopped}.
+ * {@linkplain #close() stopped}. Unless the timer does not measure a GC phase, every open/close
+ * interval is also recorded in a {@link GCPhaseHistograms.PhaseHistogram} and, for phases below
+ * the collection itself, reported as a JFR GCPhasePause event of the timer's phase level.
  */
 final class Timer implements AutoCloseable {
+    /** The timer does not measure a GC phase, e.g., the mutator timer. */
+    static final int NO_PHASE = -1;
+    /** The timer measures a whole collection, which the GC reports as a phase on its own. */
+    static final int COLLECTION_PHASE = 0;
+
     private final String name;
+    private final int phaseLevel;
+    private final GCPhaseHistograms.PhaseHistogram histogram;
     private boolean wasOpened;
     private long openNanos;
     private boolean wasClosed;
     private long closeNanos;
     private long collectedNanos;
 
-    Timer(String name) {
+    Timer(String name, int phaseLevel) {
         this.name = name;
+        this.phaseLevel = phaseLevel;
+        this.histogram = (SubstrateUtil.HOSTED && phaseLevel != NO_PHASE) ? GCPhaseHistograms.register(name) : null;
     }
 
     public String getName() {
@@ -67,7 +82,14 @@ final class Timer implements AutoCloseable {
     void closeAt(long nanoTime) {
         closeNanos = nanoTime;
         wasClosed = true;
-        collectedNanos += closeNanos - getOpenedTime();
+        long openedTime = getOpenedTime();
+        collectedNanos += closeNanos - openedTime;
+        if (histogram != null && wasOpened) {
+            histogram.record(closeNanos - openedTime);
+            if (HasJfrSupport.get() && phaseLevel > COLLECTION_PHASE) {
+                ImageSingletons.lookup(JfrGCEventSupport.class).emitGCPhasePauseEvent(GCImpl.getGCImpl().getCollectionEpoch(), phaseLevel, name, openedTime, closeNanos);
+            }
+        }
     }
 
     public void reset() {
@@ -107,26 +129,30 @@ final class Timer implements AutoCloseable {
     }
 }
 
-/** Collection timers primarily for {@link GCImpl}. */
+/**
+ * Collection timers primarily for {@link GCImpl}. The phase levels follow the nesting of the
+ * phases, as shown by {@link #logAfterCollection}.
+ */
 final class Timers {
-    final Timer blackenImageHeapRoots = new Timer("blackenImageHeapRoots");
-    final Timer blackenDirtyCardRoots = new Timer("blackenDirtyCardRoots");
-    final Timer blackenStackRoots = new Timer("blackenStackRoots");
-    final Timer cheneyScanFromRoots = new Timer("cheneyScanFromRoots");
-    final Timer cheneyScanFromDirtyRoots = new Timer("cheneyScanFromDirtyRoots");
-    final Timer collection = new Timer("collection");
-    final Timer cleanCodeCache = new Timer("cleanCodeCache");
-    final Timer referenceObjects = new Timer("referenceObjects");
-    final Timer promotePinnedObjects = new Timer("promotePinnedObjects");
-    final Timer rootScan = new Timer("rootScan");
-    final Timer scanGreyObjects = new Timer("scanGreyObjects");
-    final Timer releaseSpaces = new Timer("releaseSpaces");
-    final Timer verifyAfter = new Timer("verifyAfter");
-    final Timer verifyBefore = new Timer("verifyBefore");
-    final Timer walkThreadLocals = new Timer("walkThreadLocals");
-    final Timer walkRuntimeCodeCache = new Timer("walkRuntimeCodeCache");
-    final Timer cleanRuntimeCodeCache = new Timer("cleanRuntimeCodeCache");
-    final Timer mutator = new Timer("mutator");
+    final Timer blackenImageHeapRoots = new Timer("blackenImageHeapRoots", 3);
+    final Timer blackenDirtyCardRoots = new Timer("blackenDirtyCardRoots", 3);
+    final Timer blackenStackRoots = new Timer("blackenStackRoots", 3);
+    final Timer cheneyScanFromRoots = new Timer("cheneyScanFromRoots", 2);
+    final Timer cheneyScanFromDirtyRoots = new Timer("cheneyScanFromDirtyRoots", 2);
+    final Timer collection = new Timer("collection", Timer.COLLECTION_PHASE);
+    final Timer cleanCodeCache = new Timer("cleanCodeCache", 1);
+    final Timer referenceObjects = new Timer("referenceObjects", 1);
+    final Timer promotePinnedObjects = new Timer("promotePinnedObjects", 3);
+    final Timer rootScan = new Timer("rootScan", 1);
+    final Timer scanGreyObjects = new Timer("scanGreyObjects", 3);
+    final Timer releaseSpaces = new Timer("releaseSpaces", 1);
+    final Timer verifyAfter = new Timer("verifyAfter", 1);
+    final Timer verifyBefore = new Timer("verifyBefore", 1);
+    final Timer walkThreadLocals = new Timer("walkThreadLocals", 3);
+    final Timer walkRuntimeCodeCache = new Timer("walkRuntimeCodeCache", 3);
+    final Timer cleanRuntimeCodeCache = new Timer("cleanRuntimeCodeCache", 3);
+    /* The mutator interval is not a pause, so it is not recorded in a histogram. */
+    final Timer mutator = new Timer("mutator", Timer.NO_PHASE);
 
     Timers() {
     }
@@ -32,9 +32,11 @@ import org.graalvm.nativeimage.Platforms;
 import com.oracle.svm.core.genscavenge.CollectionPolicy;
 import com.oracle.svm.core.genscavenge.GCAccounting;
 import com.oracle.svm.core.genscavenge.GCImpl;
+import com.oracle.svm.core.genscavenge.GCPhaseHistograms;
 import com.oracle.svm.core.genscavenge.HeapAccounting;
 import com.oracle.svm.core.genscavenge.HeapImpl;
 import com.oracle.svm.core.genscavenge.HeapParameters;
+import com.oracle.svm.core.genscavenge.ReferenceProcessingStatistics;
 import com.oracle.svm.core.jvmstat.PerfDataHolder;
 import com.oracle.svm.core.jvmstat.PerfLongConstant;
 import com.oracle.svm.core.jvmstat.PerfLongCounter;
@@ -52,6 +54,8 @@ public class SerialGCPerfData implements PerfDataHolder {
     private final PerfDataCollector oldCollector;
     private final PerfDataGeneration youngGen;
     private final PerfDataGeneration oldGen;
+    private final PerfDataPhaseHistograms phaseHistograms;
+    private final PerfDataReferences references;
 
     @Platforms(Platform.HOSTED_ONLY.class)
     public SerialGCPerfData() {
@@ -72,6 +76,9 @@ public class SerialGCPerfData implements PerfDataHolder {
                         new SpacePerfData(1, oldSpaceIndex)
         };
         oldGen = new PerfDataGeneration(1, oldGenSpaces);
+
+        phaseHistograms = new PerfDataPhaseHistograms();
+        references = new PerfDataReferences();
     }
 
     @Override
@@ -90,6 +97,9 @@ public class SerialGCPerfData implements PerfDataHolder {
         oldGen.allocate("old");
         oldGen.spaces[0].allocate("old");
         assert oldGen.spaces.length == 1;
+
+        phaseHistograms.allocate();
+        references.allocate();
     }
 
     @Override
@@ -119,6 +129,9 @@ public class SerialGCPerfData implements PerfDataHolder {
         oldGen.maxCapacity.setValue(maxOldSize);
 
         oldGen.spaces[0].used.setValue(accounting.getOldGenerationAfterChunkBytes().rawValue());
+
+        phaseHistograms.update();
+        references.update();
     }
 
     private static class PerfDataGCPolicy {
@@ -211,4 +224,100 @@ public class SerialGCPerfData implements PerfDataHolder {
             used.allocate();
         }
     }
-}
\ No newline at end of file
+
+    /**
+     * Exports the {@link GCPhaseHistograms} with one {@code sun.gc.phases.<index>.bucket.<bucket>}
+     * counter per bucket and GC phase. jvmstat readers only decode scalar longs and strings, so the
+     * buckets cannot be published as a single vector. Indices are used instead of the phase names
+     * to keep the entries small, and {@code sun.gc.phases.<index>.name} maps them back. The GC
+     * timers register their histograms when the heap is created, which happens before the
+     * performance data is created.
+     */
+    private static class PerfDataPhaseHistograms {
+        private final PerfLongConstant phaseCount;
+        private final PerfLongConstant bucketCount;
+        private final PerfLongConstant firstBucketLimit;
+        private final PerfLongConstant bucketRatio;
+        private final PerfStringConstant[] names;
+        private final PerfLongVariable[][] buckets;
+        private final PerfLongVariable[] maxTimes;
+
+        @Platforms(Platform.HOSTED_ONLY.class)
+        PerfDataPhaseHistograms() {
+            PerfManager manager = ImageSingletons.lookup(PerfManager.class);
+            phaseCount = manager.createLongConstant("sun.gc.phases.count", PerfUnit.NONE);
+            bucketCount = manager.createLongConstant("sun.gc.phases.buckets", PerfUnit.NONE);
+            firstBucketLimit = manager.createLongConstant("sun.gc.phases.firstBucketLimit", PerfUnit.TICKS);
+            bucketRatio = manager.createLongConstant("sun.gc.phases.bucketRatio", PerfUnit.NONE);
+
+            int count = ImageSingletons.contains(GCPhaseHistograms.class) ? GCPhaseHistograms.singleton().getCount() : 0;
+            names = new PerfStringConstant[count];
+            buckets = new PerfLongVariable[count][GCPhaseHistograms.BUCKET_COUNT];
+            maxTimes = new PerfLongVariable[count];
+            for (int i = 0; i < count; i++) {
+                String prefix = "sun.gc.phases." + i;
+                names[i] = manager.createStringConstant(prefix + ".name");
+                for (int bucket = 0; bucket < GCPhaseHistograms.BUCKET_COUNT; bucket++) {
+                    buckets[i][bucket] = manager.createLongVariable(prefix + ".bucket." + bucket, PerfUnit.EVENTS);
+                }
+                maxTimes[i] = manager.createLongVariable(prefix + ".maxTime", PerfUnit.TICKS);
+            }
+        }
+
+        public void allocate() {
+            phaseCount.allocate(names.length);
+            bucketCount.allocate(GCPhaseHistograms.BUCKET_COUNT);
+            firstBucketLimit.allocate(GCPhaseHistograms.getBucketLimitNanos(0));
+            bucketRatio.allocate(1L << GCPhaseHistograms.BUCKET_SHIFT);
+
+            for (int i = 0; i < names.length; i++) {
+                names[i].allocate(GCPhaseHistograms.singleton().get(i).getName());
+                for (int bucket = 0; bucket < GCPhaseHistograms.BUCKET_COUNT; bucket++) {
+                    buckets[i][bucket].allocate();
+                }
+                maxTimes[i].allocate();
+            }
+        }
+
+        public void update() {
+            for (int i = 0; i < names.length; i++) {
+                GCPhaseHistograms.PhaseHistogram histogram = GCPhaseHistograms.singleton().get(i);
+                for (int bucket = 0; bucket < GCPhaseHistograms.BUCKET_COUNT; bucket++) {
+                    buckets[i][bucket].setValue(histogram.getBucketValue(bucket));
+                }
+                maxTimes[i].setValue(histogram.getMaxNanos());
+            }
+        }
+    }
+
+    private static class PerfDataReferences {
+        private final PerfLongCounter remembered;
+        private final PerfLongCounter softKeptAlive;
+        private final PerfLongCounter cleared;
+        private final PerfLongCounter pending;
+
+        @Platforms(Platform.HOSTED_ONLY.class)
+        PerfDataReferences() {
+            PerfManager manager = ImageSingletons.lookup(PerfManager.class);
+            remembered = manager.createLongCounter("sun.gc.references.remembered", PerfUnit.EVENTS);
+            softKeptAlive = manager.createLongCounter("sun.gc.references.softKeptAlive", PerfUnit.EVENTS);
+            cleared = manager.createLongCounter("sun.gc.references.cleared", PerfUnit.EVENTS);
+            pending = manager.createLongCounter("sun.gc.references.pending", PerfUnit.EVENTS);
+        }
+
+        public void allocate() {
+            remembered.allocate();
+            softKeptAlive.allocate();
+            cleared.allocate();
+            pending.allocate();
+        }
+
+        public void update() {
+            ReferenceProcessingStatistics statistics = ReferenceProcessingStatistics.get();
+            remembered.setValue(statistics.getRemembered());
+            softKeptAlive.setValue(statistics.getSoftKeptAlive());
+            cleared.setValue(statistics.getCleared());
+            pending.setValue(statistics.getPending());
+        }
+    }
+}
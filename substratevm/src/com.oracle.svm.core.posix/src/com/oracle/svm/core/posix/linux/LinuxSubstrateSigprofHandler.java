@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.posix.linux;
+
+import java.util.Collections;
+import java.util.List;
+
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.IsolateThread;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+import org.graalvm.nativeimage.StackValue;
+import org.graalvm.nativeimage.c.function.CEntryPoint;
+import org.graalvm.nativeimage.c.function.CEntryPointLiteral;
+import org.graalvm.nativeimage.c.function.CodePointer;
+import org.graalvm.nativeimage.c.struct.SizeOf;
+import org.graalvm.nativeimage.c.type.CIntPointer;
+import org.graalvm.nativeimage.hosted.Feature;
+import org.graalvm.word.Pointer;
+import org.graalvm.word.UnsignedWord;
+import org.graalvm.word.WordFactory;
+
+import com.oracle.svm.core.IsolateListenerSupport;
+import com.oracle.svm.core.RegisterDumper;
+import com.oracle.svm.core.Uninterruptible;
+import com.oracle.svm.core.c.function.CEntryPointOptions;
+import com.oracle.svm.core.c.function.CEntryPointOptions.NoEpilogue;
+import com.oracle.svm.core.c.function.CEntryPointOptions.NoPrologue;
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.headers.LibC;
+import com.oracle.svm.core.jfr.JfrFeature;
+import com.oracle.svm.core.jfr.sampler.JfrExecutionSampler;
+import com.oracle.svm.core.jfr.sampler.SubstrateSigprofHandler;
+import com.oracle.svm.core.posix.PosixUtils;
+import com.oracle.svm.core.posix.headers.Signal;
+import com.oracle.svm.core.posix.headers.Signal.AdvancedSignalDispatcher;
+import com.oracle.svm.core.posix.headers.Signal.siginfo_t;
+import com.oracle.svm.core.posix.headers.Signal.ucontext_t;
+import com.oracle.svm.core.posix.headers.linux.LinuxPthread;
+import com.oracle.svm.core.posix.headers.linux.LinuxTime;
+import com.oracle.svm.core.thread.ThreadListenerSupport;
+import com.oracle.svm.core.util.VMError;
+
+/**
+ * Samples the executing threads with a {@code SIGPROF} signal. The interval timer counts the CPU
+ * time of the whole process, so the signal is delivered to a thread that is currently running,
+ * which is then walked from the interrupted instruction.
+ */
+public final class LinuxSubstrateSigprofHandler extends SubstrateSigprofHandler {
+    private static final CEntryPointLiteral<AdvancedSignalDispatcher> advancedSignalDispatcher = CEntryPointLiteral.create(LinuxSubstrateSigprofHandler.class,
+                    "dispatch", int.class, siginfo_t.class, ucontext_t.class);
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    LinuxSubstrateSigprofHandler() {
+    }
+
+    @SuppressWarnings("unused")
+    @CEntryPoint(include = CEntryPoint.NotIncludedAutomatically.class, publishAs = CEntryPoint.Publish.NotPublished)
+    @CEntryPointOptions(prologue = NoPrologue.class, epilogue = NoEpilogue.class)
+    @Uninterruptible(reason = "The method executes during signal handling.")
+    private static void dispatch(int signalNumber, siginfo_t sigInfo, ucontext_t uContext) {
+        /* Keep the code in here to a minimum, the interrupted thread may be in any state. */
+        int savedErrno = LibC.errno();
+        try {
+            if (tryEnterIsolate()) {
+                CodePointer ip = (CodePointer) RegisterDumper.singleton().getIP(uContext);
+                Pointer sp = (Pointer) RegisterDumper.singleton().getSP(uContext);
+                tryUninterruptibleStackWalk(ip, sp);
+            }
+        } finally {
+            /* The interrupted code may be about to read errno. */
+            LibC.setErrno(savedErrno);
+        }
+    }
+
+    @Override
+    protected void installSignalHandler() {
+        int structSigActionSize = SizeOf.get(Signal.sigaction.class);
+        Signal.sigaction structSigAction = StackValue.get(structSigActionSize);
+        LibC.memset(structSigAction, WordFactory.signed(0), WordFactory.unsigned(structSigActionSize));
+
+        /* SA_RESTART, so that the signal does not make interruptible system calls fail. */
+        structSigAction.sa_flags(Signal.SA_SIGINFO() | Signal.SA_RESTART());
+        structSigAction.sa_sigaction(advancedSignalDispatcher.getFunctionPointer());
+        Signal.sigemptyset(structSigAction.sa_mask());
+        PosixUtils.checkStatusIs0(Signal.sigaction(Signal.SignalEnum.SIGPROF.getCValue(), structSigAction, WordFactory.nullPointer()), "sigaction(SIGPROF, signalHandler, null) failed");
+    }
+
+    @Override
+    protected void updateTimer(long intervalMillis) {
+        LinuxTime.itimerval newValue = StackValue.get(LinuxTime.itimerval.class);
+        long seconds = intervalMillis / 1000;
+        long micros = (intervalMillis % 1000) * 1000;
+        newValue.it_interval().set_tv_sec(seconds);
+        newValue.it_interval().set_tv_usec(micros);
+        newValue.it_value().set_tv_sec(seconds);
+        newValue.it_value().set_tv_usec(micros);
+        PosixUtils.checkStatusIs0(LinuxTime.NoTransitions.setitimer(LinuxTime.ITIMER_PROF(), newValue, WordFactory.nullPointer()), "setitimer(ITIMER_PROF) failed");
+    }
+
+    @Override
+    @Uninterruptible(reason = "Thread state not yet set up.")
+    protected UnsignedWord createThreadLocalKey() {
+        CIntPointer key = StackValue.get(CIntPointer.class);
+        int status = LinuxPthread.NoTransitions.pthread_key_create(key, WordFactory.nullPointer());
+        VMError.guarantee(status == 0, "pthread_key_create failed");
+        return WordFactory.unsigned(key.read());
+    }
+
+    @Override
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    protected void setThreadLocalKeyValue(UnsignedWord key, IsolateThread value) {
+        int status = LinuxPthread.NoTransitions.pthread_setspecific((int) key.rawValue(), value);
+        VMError.guarantee(status == 0, "pthread_setspecific failed");
+    }
+
+    @Override
+    @Uninterruptible(reason = "The method executes during signal handling.", mayBeInlined = true)
+    protected IsolateThread getThreadLocalKeyValue(UnsignedWord key) {
+        return (IsolateThread) LinuxPthread.NoTransitions.pthread_getspecific((int) key.rawValue());
+    }
+}
+
+@AutomaticallyRegisteredFeature
+class LinuxSubstrateSigprofHandlerFeature implements InternalFeature {
+    @Override
+    public boolean isInConfiguration(IsInConfigurationAccess access) {
+        return SubstrateSigprofHandler.Options.SignalHandlerBasedExecutionSampler.getValue();
+    }
+
+    @Override
+    public List<Class<? extends Feature>> getRequiredFeatures() {
+        return Collections.singletonList(JfrFeature.class);
+    }
+
+    @Override
+    public void afterRegistration(AfterRegistrationAccess access) {
+        /* Must happen before the recurring callback sampler registers itself during setup. */
+        if (JfrFeature.isExecutionSamplerSupported() && !ImageSingletons.contains(JfrExecutionSampler.class)) {
+            LinuxSubstrateSigprofHandler sampler = new LinuxSubstrateSigprofHandler();
+            ImageSingletons.add(JfrExecutionSampler.class, sampler);
+            ImageSingletons.add(SubstrateSigprofHandler.class, sampler);
+        }
+    }
+
+    @Override
+    public void duringSetup(DuringSetupAccess access) {
+        if (ImageSingletons.contains(SubstrateSigprofHandler.class)) {
+            SubstrateSigprofHandler sampler = ImageSingletons.lookup(SubstrateSigprofHandler.class);
+            IsolateListenerSupport.singleton().register(sampler);
+            ThreadListenerSupport.get().register(sampler);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.posix.linux;
+
+import org.graalvm.word.PointerBase;
+import org.graalvm.word.UnsignedWord;
+
+import com.oracle.svm.core.Uninterruptible;
+import com.oracle.svm.core.feature.AutomaticallyRegisteredImageSingleton;
+import com.oracle.svm.core.os.TransparentHugePageSupport;
+import com.oracle.svm.core.posix.headers.linux.LinuxMman;
+
+/**
+ * Uses {@code madvise(MADV_HUGEPAGE)}, which only has an effect if transparent huge pages are
+ * configured as {@code madvise} or {@code always} in {@code /sys/kernel/mm/transparent_hugepage}.
+ * On kernels without transparent huge page support, the call fails and the memory is simply
+ * backed by regular pages.
+ */
+@AutomaticallyRegisteredImageSingleton(TransparentHugePageSupport.class)
+class LinuxTransparentHugePageSupport implements TransparentHugePageSupport {
+    @Override
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    public boolean adviseHugePages(PointerBase start, UnsignedWord nbytes) {
+        return LinuxMman.NoTransitions.madvise(start, nbytes, LinuxMman.MADV_HUGEPAGE()) == 0;
+    }
+}
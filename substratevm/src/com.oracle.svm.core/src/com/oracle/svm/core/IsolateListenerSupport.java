@@ -30,6 +30,7 @@ import java.util.Arrays;
 import org.graalvm.compiler.api.replacements.Fold;
 import org.graalvm.nativeimage.ImageSingletons;
 import org.graalvm.nativeimage.Isolate;
+import org.graalvm.nativeimage.IsolateThread;
 import org.graalvm.nativeimage.Platform;
 import org.graalvm.nativeimage.Platforms;
 
@@ -64,6 +65,25 @@ public class IsolateListenerSupport {
         }
     }
 
+    /**
+     * Called on every thread that attaches to the isolate, including the thread that created it,
+     * as soon as the thread is registered and before it executes any Java code.
+     */
+    @Uninterruptible(reason = "Thread state not yet set up.")
+    public void afterAttachThread(IsolateThread thread) {
+        for (int i = 0; i < listeners.length; i++) {
+            listeners[i].afterAttachThread(thread);
+        }
+    }
+
+    /** Called on every thread that detaches from the isolate, while it is still registered. */
+    @Uninterruptible(reason = "Thread state no longer set up.")
+    public void beforeDetachThread(IsolateThread thread) {
+        for (int i = listeners.length - 1; i >= 0; i--) {
+            listeners[i].beforeDetachThread(thread);
+        }
+    }
+
     @Uninterruptible(reason = "The isolate teardown is in progress.")
     public void onIsolateTeardown() {
         for (int i = 0; i < listeners.length; i++) {
@@ -75,6 +95,14 @@ public class IsolateListenerSupport {
         @Uninterruptible(reason = "Thread state not yet set up.")
         void afterCreateIsolate(Isolate isolate);
 
+        @Uninterruptible(reason = "Thread state not yet set up.")
+        default void afterAttachThread(@SuppressWarnings("unused") IsolateThread thread) {
+        }
+
+        @Uninterruptible(reason = "Thread state no longer set up.")
+        default void beforeDetachThread(@SuppressWarnings("unused") IsolateThread thread) {
+        }
+
         @Uninterruptible(reason = "The isolate teardown is in progress.")
         default void onIsolateTeardown() {
         }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.code;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+import org.graalvm.nativeimage.c.function.CodePointer;
+
+import com.oracle.svm.core.Uninterruptible;
+import com.oracle.svm.core.feature.AutomaticallyRegisteredImageSingleton;
+
+/**
+ * A small direct-mapped cache from instruction pointers in the image code to their decoded
+ * {@link FrameInfoQueryResult frame info}, so that stack walks that repeatedly pass the same call
+ * sites do not have to decode them from the compact code info tables again.
+ * <p>
+ * The cache is lock-free: every slot holds an immutable {@link Entry}, which is replaced as a whole,
+ * and a lookup only returns the frame info of an entry whose IP matches. The frame info must not be
+ * modified once it was {@linkplain #put added}, so frame info decoded into reusable or pooled
+ * objects must not be cached.
+ * <p>
+ * Only frame info of the image code may be cached. Runtime-compiled code can be invalidated and
+ * freed, and its IPs can then be reused for other code.
+ */
+@AutomaticallyRegisteredImageSingleton
+public final class CodeInfoQueryCache {
+    private static final int SIZE = 1024;
+
+    private static final class Entry {
+        final long ip;
+        final FrameInfoQueryResult frameInfo;
+
+        Entry(long ip, FrameInfoQueryResult frameInfo) {
+            this.ip = ip;
+            this.frameInfo = frameInfo;
+        }
+    }
+
+    private final Entry[] entries;
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    CodeInfoQueryCache() {
+        entries = new Entry[SIZE];
+    }
+
+    @Fold
+    public static CodeInfoQueryCache singleton() {
+        return ImageSingletons.lookup(CodeInfoQueryCache.class);
+    }
+
+    /** Returns the cached frame info for the IP, or null if it is not cached. */
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    public FrameInfoQueryResult get(CodePointer ip) {
+        Entry entry = entries[index(ip)];
+        if (entry != null && entry.ip == ip.rawValue()) {
+            return entry.frameInfo;
+        }
+        return null;
+    }
+
+    /** Caches the frame info of an IP in the image code. Replaces the entry that used the same slot. */
+    public void put(CodePointer ip, FrameInfoQueryResult frameInfo) {
+        assert frameInfo != null;
+        entries[index(ip)] = new Entry(ip.rawValue(), frameInfo);
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    private static int index(CodePointer ip) {
+        long value = ip.rawValue();
+        /* Call sites are usually only a few bytes apart, so mix in the higher bits. */
+        return (int) ((value ^ (value >>> 10)) & (SIZE - 1));
+    }
+}
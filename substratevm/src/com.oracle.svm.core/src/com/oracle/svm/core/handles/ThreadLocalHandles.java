@@ -38,9 +38,18 @@ import com.oracle.svm.core.Uninterruptible;
  * Implementation of local object handles, which are bound to a specific thread and can be created
  * and destroyed implicitly or explicitly. Local handles can be managed in frames and a frame can be
  * discarded in its entirety.
+ *
+ * The handles are stored in fixed-size segments, so growing the capacity only allocates a new
+ * segment and never copies more than one segment of handles. Segments are kept when frames are
+ * popped and are reused by subsequent frames. The first segment starts out with only the initial
+ * capacity, so that threads with few handles do not allocate a whole segment.
  */
 public final class ThreadLocalHandles<T extends ObjectHandle> {
     private static final int INITIAL_NUMBER_OF_FRAMES = 4;
+    private static final int INITIAL_NUMBER_OF_SEGMENTS = 4;
+    private static final int SEGMENT_SHIFT = 8;
+    private static final int SEGMENT_SIZE = 1 << SEGMENT_SHIFT;
+    private static final int SEGMENT_MASK = SEGMENT_SIZE - 1;
 
     public static final int MIN_VALUE = Math.toIntExact(1 + nullHandle().rawValue());
     public static final int MAX_VALUE = Integer.MAX_VALUE;
@@ -55,14 +64,22 @@ public final class ThreadLocalHandles<T extends ObjectHandle> {
         return handle.rawValue() >= MIN_VALUE && handle.rawValue() <= MAX_VALUE;
     }
 
-    private Object[] objects;
+    private Object[][] segments;
+    private int capacity;
     private int top = MIN_VALUE;
 
     private int[] frameStack = new int[INITIAL_NUMBER_OF_FRAMES];
     private int frameCount = 0;
 
     public ThreadLocalHandles(int initialNumberOfHandles) {
-        objects = new Object[MIN_VALUE + initialNumberOfHandles];
+        segments = new Object[INITIAL_NUMBER_OF_SEGMENTS][];
+        int initialLength = MIN_VALUE + initialNumberOfHandles;
+        if (initialLength <= SEGMENT_SIZE) {
+            segments[0] = new Object[initialLength];
+            capacity = initialLength;
+        } else {
+            growCapacity(initialLength);
+        }
     }
 
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
@@ -74,13 +91,13 @@ public final class ThreadLocalHandles<T extends ObjectHandle> {
         return top - MIN_VALUE;
     }
 
-    public int pushFrame(int capacity) {
+    public int pushFrame(int frameCapacity) {
         if (frameCount == frameStack.length) {
             growFrameStack();
         }
         frameStack[frameCount] = top;
         frameCount++;
-        ensureCapacity(capacity);
+        ensureCapacity(frameCapacity);
         return frameCount;
     }
 
@@ -104,11 +121,11 @@ public final class ThreadLocalHandles<T extends ObjectHandle> {
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
     public T tryCreateNonNull(Object obj) {
         assert obj != null;
-        if (top >= objects.length) {
+        if (top >= capacity) {
             return nullHandle();
         }
         int index = top;
-        objects[index] = obj;
+        segments[index >>> SEGMENT_SHIFT][index & SEGMENT_MASK] = obj;
         top++;
         return WordFactory.signed(index);
     }
@@ -116,13 +133,15 @@ public final class ThreadLocalHandles<T extends ObjectHandle> {
     @SuppressWarnings("unchecked")
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
     public <U> U getObject(T handle) {
-        return (U) objects[toIndex(handle)];
+        int index = toIndex(handle);
+        return (U) segments[index >>> SEGMENT_SHIFT][index & SEGMENT_MASK];
     }
 
     public boolean delete(T handle) {
         int index = toIndex(handle);
-        Object previous = objects[index];
-        objects[index] = null;
+        Object[] segment = segments[index >>> SEGMENT_SHIFT];
+        Object previous = segment[index & SEGMENT_MASK];
+        segment[index & SEGMENT_MASK] = null;
         return previous != null;
     }
 
@@ -136,19 +155,42 @@ public final class ThreadLocalHandles<T extends ObjectHandle> {
         frameCount = frame - 1;
         top = frameStack[frameCount];
         for (int i = top; i < previousTop; i++) {
-            objects[i] = null; // so objects can be garbage collected
+            segments[i >>> SEGMENT_SHIFT][i & SEGMENT_MASK] = null; // so objects can be garbage collected
         }
     }
 
-    public void ensureCapacity(int capacity) {
-        int minLength = top + capacity;
-        if (minLength >= objects.length) {
+    public void ensureCapacity(int additionalCapacity) {
+        int minLength = Math.addExact(top, additionalCapacity);
+        if (minLength >= capacity) {
             growCapacity(minLength);
         }
     }
 
+    /** Adds segments until there is room for more than {@code minLength} handles. */
     @NeverInline("Decrease code size of JNI entry points by not inlining allocations")
     private void growCapacity(int minLength) {
-        objects = Arrays.copyOf(objects, minLength * 2);
+        Object[] first = segments[0];
+        if (first != null && first.length < SEGMENT_SIZE) {
+            if (minLength < SEGMENT_SIZE) {
+                int newLength = Math.min(minLength * 2, SEGMENT_SIZE);
+                segments[0] = Arrays.copyOf(first, newLength);
+                capacity = newLength;
+                return;
+            }
+            /* Complete the first segment before adding more. */
+            segments[0] = Arrays.copyOf(first, SEGMENT_SIZE);
+            capacity = SEGMENT_SIZE;
+        }
+
+        int requiredSegments = (minLength >>> SEGMENT_SHIFT) + 1;
+        if (requiredSegments > segments.length) {
+            /* Only the segment references are copied, not the handles. */
+            segments = Arrays.copyOf(segments, Math.max(requiredSegments, segments.length * 2));
+        }
+        for (int i = capacity >>> SEGMENT_SHIFT; i < requiredSegments; i++) {
+            segments[i] = new Object[SEGMENT_SIZE];
+        }
+        /* The last segment can reach beyond the largest handle value. */
+        capacity = (int) Math.min((long) requiredSegments * SEGMENT_SIZE, MAX_VALUE);
     }
-}
\ No newline at end of file
+}
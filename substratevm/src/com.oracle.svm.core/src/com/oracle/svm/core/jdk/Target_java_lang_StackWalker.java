@@ -51,6 +51,7 @@ import com.oracle.svm.core.annotate.TargetClass;
 import com.oracle.svm.core.annotate.TargetElement;
 import com.oracle.svm.core.code.CodeInfo;
 import com.oracle.svm.core.code.CodeInfoAccess;
+import com.oracle.svm.core.code.CodeInfoQueryCache;
 import com.oracle.svm.core.code.CodeInfoTable;
 import com.oracle.svm.core.code.FrameInfoQueryResult;
 import com.oracle.svm.core.code.SimpleCodeInfoQueryResult;
@@ -186,7 +187,19 @@ final class Target_java_lang_StackWalker {
 
         @Uninterruptible(reason = "Wraps the now safe call to query frame information.", calleeMustBe = false)
         protected FrameInfoQueryResult queryFrameInfo(CodeInfo info, CodePointer ip) {
-            return CodeInfoTable.lookupCodeInfoQueryResult(info, ip).getFrameInfo();
+            /* Runtime-compiled code can be freed and its IPs reused, so only image code is cached. */
+            boolean imageCode = info.equal(CodeInfoTable.getImageCodeInfo());
+            if (imageCode) {
+                FrameInfoQueryResult cached = CodeInfoQueryCache.singleton().get(ip);
+                if (cached != null) {
+                    return cached;
+                }
+            }
+            FrameInfoQueryResult frameInfo = CodeInfoTable.lookupCodeInfoQueryResult(info, ip).getFrameInfo();
+            if (imageCode && frameInfo != null) {
+                CodeInfoQueryCache.singleton().put(ip, frameInfo);
+            }
+            return frameInfo;
         }
 
         protected DeoptimizedFrame.VirtualFrame curDeoptimizedFrame;
@@ -45,10 +45,12 @@ import java.util.zip.GZIPInputStream;
 import java.util.zip.GZIPOutputStream;
 
 import org.graalvm.collections.Pair;
+import org.graalvm.compiler.options.Option;
 import org.graalvm.nativeimage.Platform;
 import org.graalvm.nativeimage.Platforms;
 
 import com.oracle.svm.core.jdk.localization.bundles.CompressedBundle;
+import com.oracle.svm.core.option.HostedOptionKey;
 import com.oracle.svm.core.util.VMError;
 
 /**
@@ -70,9 +72,16 @@ import com.oracle.svm.core.util.VMError;
  * length of the value array or -1 for simple string values. KEY_LEN and VALUE_LEN should be
  * self-explanatory.
  *
+ * If {@link Options#IndexedBundleCompression} is enabled, bundles are compressed with
+ * {@link IndexedBundleCompression} instead, which decompresses only the accessed parts.
  */
 public class GzipBundleCompression {
 
+    public static class Options {
+        @Option(help = "Compress resource bundles in blocks that are decompressed on first access of one of their keys, instead of as a whole.")//
+        public static final HostedOptionKey<Boolean> IndexedBundleCompression = new HostedOptionKey<>(false);
+    }
+
     @Platforms(Platform.HOSTED_ONLY.class)
     public static boolean canCompress(ResourceBundle bundle) {
         return extractContent(bundle)
@@ -83,6 +92,9 @@ public class GzipBundleCompression {
 
     @Platforms(Platform.HOSTED_ONLY.class)
     public static CompressedBundle compress(ResourceBundle bundle) {
+        if (Options.IndexedBundleCompression.getValue()) {
+            return IndexedBundleCompression.compress(bundle);
+        }
         final Map<String, Object> content = extractContent(bundle);
         Pair<String, int[]> input = serializeContent(content);
         try (ByteArrayOutputStream byteStream = new ByteArrayOutputStream(); GZIPOutputStream out = new GZIPOutputStream(byteStream)) {
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.jdk.localization.compression;
+
+import static com.oracle.svm.core.jdk.localization.compression.utils.BundleSerializationUtils.deserializeContent;
+import static com.oracle.svm.core.jdk.localization.compression.utils.BundleSerializationUtils.extractContent;
+import static com.oracle.svm.core.jdk.localization.compression.utils.BundleSerializationUtils.serializeContent;
+import static com.oracle.svm.core.jdk.localization.compression.utils.CompressionUtils.bytesToInts;
+import static com.oracle.svm.core.jdk.localization.compression.utils.CompressionUtils.intsToBytes;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.lang.ref.SoftReference;
+import java.nio.charset.StandardCharsets;
+import java.util.AbstractMap;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Map;
+import java.util.ResourceBundle;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+import java.util.zip.DataFormatException;
+import java.util.zip.Deflater;
+import java.util.zip.Inflater;
+
+import org.graalvm.collections.Pair;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+
+import com.oracle.svm.core.jdk.localization.bundles.CompressedBundle;
+import com.oracle.svm.core.util.VMError;
+
+/**
+ * Alternative to {@link GzipBundleCompression} for large bundles that are only sparsely accessed,
+ * used by {@link GzipBundleCompression#compress} if
+ * {@link GzipBundleCompression.Options#IndexedBundleCompression} is enabled.
+ * The entries are sorted by key and split into blocks of {@link #BLOCK_SIZE} entries, each of which
+ * is compressed on its own (in the format of {@link GzipBundleCompression}). The keys are stored
+ * uncompressed in front of the blocks, so that a lookup only has to decompress the block that
+ * contains the key. Decompressed blocks are only softly referenced and can therefore be dropped
+ * under memory pressure.
+ *
+ * The serialization format is the following:
+ *
+ * KEY_COUNT KEY{KEY_COUNT} BLOCK_COUNT (BLOCK_LEN BLOCK_UNCOMPRESSED_LEN BLOCK){BLOCK_COUNT}
+ */
+public class IndexedBundleCompression {
+    private static final int BLOCK_SIZE = 64;
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public static boolean canCompress(ResourceBundle bundle) {
+        return GzipBundleCompression.canCompress(bundle);
+    }
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public static CompressedBundle compress(ResourceBundle bundle) {
+        TreeMap<String, Object> content = new TreeMap<>(extractContent(bundle));
+        String[] keys = content.keySet().toArray(new String[0]);
+        try (ByteArrayOutputStream byteStream = new ByteArrayOutputStream(); DataOutputStream out = new DataOutputStream(byteStream)) {
+            out.writeInt(keys.length);
+            for (String key : keys) {
+                out.writeUTF(key);
+            }
+            int blockCount = (keys.length + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            out.writeInt(blockCount);
+            for (int i = 0; i < blockCount; i++) {
+                int from = i * BLOCK_SIZE;
+                int to = Math.min(from + BLOCK_SIZE, keys.length);
+                byte[] block = serializeBlock(content.subMap(keys[from], true, keys[to - 1], true));
+                byte[] compressed = deflate(block);
+                out.writeInt(compressed.length);
+                out.writeInt(block.length);
+                out.write(compressed);
+            }
+            out.flush();
+            return new CompressedBundle(byteStream.toByteArray(), IndexedBundleCompression::decompressBundle);
+        } catch (IOException ex) {
+            throw VMError.shouldNotReachHere("Compression of a bundle " + bundle.getClass() + " failed. This is an internal error. Please open an issue and submit a reproducer.", ex);
+        }
+    }
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    private static byte[] serializeBlock(Map<String, Object> block) throws IOException {
+        Pair<String, int[]> input = serializeContent(block);
+        try (ByteArrayOutputStream byteStream = new ByteArrayOutputStream(); DataOutputStream out = new DataOutputStream(byteStream)) {
+            byte[] indicesInBytes = intsToBytes(input.getRight());
+            out.writeInt(indicesInBytes.length);
+            out.write(indicesInBytes);
+            byte[] textBytes = input.getLeft().getBytes(StandardCharsets.UTF_8);
+            out.writeInt(textBytes.length);
+            out.write(textBytes);
+            out.flush();
+            return byteStream.toByteArray();
+        }
+    }
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    private static byte[] deflate(byte[] data) {
+        Deflater deflater = new Deflater(Deflater.BEST_COMPRESSION);
+        try {
+            deflater.setInput(data);
+            deflater.finish();
+            ByteArrayOutputStream out = new ByteArrayOutputStream(data.length);
+            byte[] buffer = new byte[4096];
+            while (!deflater.finished()) {
+                int n = deflater.deflate(buffer);
+                out.write(buffer, 0, n);
+            }
+            return out.toByteArray();
+        } finally {
+            deflater.end();
+        }
+    }
+
+    private static Map<String, Object> decompressBundle(byte[] data) {
+        try (DataInputStream in = new DataInputStream(new ByteArrayInputStream(data))) {
+            String[] keys = new String[in.readInt()];
+            for (int i = 0; i < keys.length; i++) {
+                keys[i] = in.readUTF();
+            }
+            int blockCount = in.readInt();
+            int[] blockOffsets = new int[blockCount];
+            int offset = data.length - in.available();
+            for (int i = 0; i < blockCount; i++) {
+                blockOffsets[i] = offset;
+                int compressedLength = in.readInt();
+                in.skipBytes(Integer.BYTES + compressedLength);
+                offset += 2 * Integer.BYTES + compressedLength;
+            }
+            return new LazyBundleContent(data, keys, blockOffsets);
+        } catch (IOException e) {
+            throw VMError.shouldNotReachHere("Decompressing a resource bundle failed.", e);
+        }
+    }
+
+    /**
+     * Read-only view of the bundle content that decompresses blocks on demand. Looking up keys
+     * and iterating the key set does not decompress anything.
+     */
+    private static final class LazyBundleContent extends AbstractMap<String, Object> {
+        private final byte[] data;
+        private final String[] keys;
+        private final int[] blockOffsets;
+        private final AtomicReferenceArray<SoftReference<Map<String, Object>>> blocks;
+        private volatile Set<String> keySet;
+
+        LazyBundleContent(byte[] data, String[] keys, int[] blockOffsets) {
+            this.data = data;
+            this.keys = keys;
+            this.blockOffsets = blockOffsets;
+            this.blocks = new AtomicReferenceArray<>(blockOffsets.length);
+        }
+
+        @Override
+        public Object get(Object key) {
+            if (!(key instanceof String)) {
+                return null;
+            }
+            int index = Arrays.binarySearch(keys, key);
+            if (index < 0) {
+                return null;
+            }
+            return getBlock(index / BLOCK_SIZE).get(key);
+        }
+
+        @Override
+        public boolean containsKey(Object key) {
+            return key instanceof String && Arrays.binarySearch(keys, key) >= 0;
+        }
+
+        @Override
+        public int size() {
+            return keys.length;
+        }
+
+        @Override
+        public Set<String> keySet() {
+            if (keySet == null) {
+                keySet = Collections.unmodifiableSet(new HashSet<>(Arrays.asList(keys)));
+            }
+            return keySet;
+        }
+
+        @Override
+        public Set<Entry<String, Object>> entrySet() {
+            Map<String, Object> all = new HashMap<>();
+            for (int i = 0; i < blocks.length(); i++) {
+                all.putAll(getBlock(i));
+            }
+            return Collections.unmodifiableMap(all).entrySet();
+        }
+
+        private Map<String, Object> getBlock(int blockIndex) {
+            SoftReference<Map<String, Object>> ref = blocks.get(blockIndex);
+            Map<String, Object> block = ref == null ? null : ref.get();
+            if (block == null) {
+                /* Racing threads may decompress the same block, which is harmless. */
+                block = decompressBlock(blockIndex);
+                blocks.set(blockIndex, new SoftReference<>(block));
+            }
+            return block;
+        }
+
+        private Map<String, Object> decompressBlock(int blockIndex) {
+            int offset = blockOffsets[blockIndex];
+            int compressedLength = readInt(data, offset);
+            int uncompressedLength = readInt(data, offset + Integer.BYTES);
+            byte[] block = new byte[uncompressedLength];
+            Inflater inflater = new Inflater();
+            try {
+                inflater.setInput(data, offset + 2 * Integer.BYTES, compressedLength);
+                int read = 0;
+                while (!inflater.finished()) {
+                    if (inflater.needsInput() || inflater.needsDictionary() || read == uncompressedLength) {
+                        throw VMError.shouldNotReachHere("Decompressing a resource bundle failed: block does not match its recorded length.");
+                    }
+                    read += inflater.inflate(block, read, uncompressedLength - read);
+                }
+                if (read != uncompressedLength) {
+                    throw VMError.shouldNotReachHere("Decompressing a resource bundle failed: expected " + uncompressedLength + " bytes but got " + read + ".");
+                }
+            } catch (DataFormatException e) {
+                throw VMError.shouldNotReachHere("Decompressing a resource bundle failed.", e);
+            } finally {
+                inflater.end();
+            }
+
+            int indicesLength = readInt(block, 0);
+            int[] indices = bytesToInts(Arrays.copyOfRange(block, Integer.BYTES, Integer.BYTES + indicesLength));
+            int textStart = Integer.BYTES + indicesLength;
+            int textLength = readInt(block, textStart);
+            String text = new String(block, textStart + Integer.BYTES, textLength, StandardCharsets.UTF_8);
+            return deserializeContent(indices, text);
+        }
+
+        private static int readInt(byte[] bytes, int offset) {
+            return ((bytes[offset] & 0xff) << 24) | ((bytes[offset + 1] & 0xff) << 16) | ((bytes[offset + 2] & 0xff) << 8) | (bytes[offset + 3] & 0xff);
+        }
+    }
+}
@@ -32,6 +32,7 @@ import java.nio.channels.ClosedChannelException;
 import java.nio.channels.NonWritableChannelException;
 import java.nio.channels.SeekableByteChannel;
 import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicIntegerFieldUpdater;
 import java.util.concurrent.locks.ReadWriteLock;
 import java.util.concurrent.locks.ReentrantReadWriteLock;
 
@@ -45,23 +46,30 @@ import java.util.concurrent.locks.ReentrantReadWriteLock;
  * because substituted class is final</li>
  * </ul>
  * </p>
+ * <p>
+ * A read-only channel never changes its buffer or its size, so it does not take the lock: the
+ * position is advanced with a compare-and-set, so that concurrent reads still consume disjoint
+ * parts, and closing it does not release the buffer, which is shared with the resource.
+ * </p>
  */
 public class ByteArrayChannel implements SeekableByteChannel {
 
+    private static final AtomicIntegerFieldUpdater<ByteArrayChannel> POS_UPDATER = AtomicIntegerFieldUpdater.newUpdater(ByteArrayChannel.class, "pos");
+
     private final ReadWriteLock rwlock = new ReentrantReadWriteLock();
     private byte[] buf;
 
     /**
      * The current position of this channel.
      */
-    private int pos;
+    private volatile int pos;
 
     /**
      * The index that is one greater than the last valid byte in the channel.
      */
     private int last;
 
-    private boolean closed;
+    private volatile boolean closed;
     private final boolean readonly;
 
     /**
@@ -91,6 +99,10 @@ public class ByteArrayChannel implements SeekableByteChannel {
 
     @Override
     public long position() throws IOException {
+        if (readonly) {
+            ensureOpen();
+            return pos;
+        }
         beginRead();
         try {
             ensureOpen();
@@ -102,12 +114,16 @@ public class ByteArrayChannel implements SeekableByteChannel {
 
     @Override
     public SeekableByteChannel position(long position) throws IOException {
+        if (readonly) {
+            ensureOpen();
+            checkPosition(position);
+            this.pos = Math.min((int) position, last);
+            return this;
+        }
         beginWrite();
         try {
             ensureOpen();
-            if (position < 0 || position >= Integer.MAX_VALUE) {
-                throw new IllegalArgumentException("Illegal position " + position);
-            }
+            checkPosition(position);
             this.pos = Math.min((int) position, last);
             return this;
         } finally {
@@ -117,6 +133,9 @@ public class ByteArrayChannel implements SeekableByteChannel {
 
     @Override
     public int read(ByteBuffer dst) throws IOException {
+        if (readonly) {
+            return readLockFree(dst);
+        }
         beginWrite();
         try {
             ensureOpen();
@@ -132,6 +151,21 @@ public class ByteArrayChannel implements SeekableByteChannel {
         }
     }
 
+    private int readLockFree(ByteBuffer dst) throws IOException {
+        ensureOpen();
+        int p;
+        int n;
+        do {
+            p = pos;
+            if (p == last) {
+                return -1;
+            }
+            n = Math.min(dst.remaining(), last - p);
+        } while (!POS_UPDATER.compareAndSet(this, p, p + n));
+        dst.put(buf, p, n);
+        return n;
+    }
+
     @Override
     public SeekableByteChannel truncate(long size) throws IOException {
         if (readonly) {
@@ -164,6 +198,10 @@ public class ByteArrayChannel implements SeekableByteChannel {
 
     @Override
     public long size() throws IOException {
+        if (readonly) {
+            ensureOpen();
+            return last;
+        }
         beginRead();
         try {
             ensureOpen();
@@ -178,6 +216,10 @@ public class ByteArrayChannel implements SeekableByteChannel {
         if (closed) {
             return;
         }
+        if (readonly) {
+            closed = true;
+            return;
+        }
 
         beginWrite();
         try {
@@ -197,6 +239,9 @@ public class ByteArrayChannel implements SeekableByteChannel {
      * @return the current contents of this channel, as a byte array.
      */
     public byte[] toByteArray() {
+        if (readonly) {
+            return Arrays.copyOf(buf, last);
+        }
         beginRead();
         try {
             // avoid copy if last == bytes.length?
@@ -212,6 +257,12 @@ public class ByteArrayChannel implements SeekableByteChannel {
         }
     }
 
+    private static void checkPosition(long position) {
+        if (position < 0 || position >= Integer.MAX_VALUE) {
+            throw new IllegalArgumentException("Illegal position " + position);
+        }
+    }
+
     private void beginWrite() {
         rwlock.writeLock().lock();
     }
@@ -53,16 +53,15 @@ import java.nio.file.spi.FileSystemProvider;
 import java.util.Map;
 import java.util.Set;
 import java.util.concurrent.locks.Lock;
-import java.util.concurrent.locks.ReadWriteLock;
-import java.util.concurrent.locks.ReentrantReadWriteLock;
+import java.util.concurrent.locks.ReentrantLock;
 
 public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
 
     private final String resourcePath = "/resources";
     private final String resourceUri = JavaNetSubstitutions.FILE_PROTOCOL + ":" + resourcePath;
-    private NativeImageResourceFileSystem fileSystem;
-    private final Lock writeLock;
-    private final Lock readLock;
+    /* Written while holding fileSystemLock, but read without locking on the hot path. */
+    private volatile NativeImageResourceFileSystem fileSystem;
+    private final Lock fileSystemLock;
 
     private Path uriToPath(URI uri) {
         String scheme = uri.getScheme();
@@ -79,9 +78,7 @@ public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
     }
 
     public NativeImageResourceFileSystemProvider() {
-        ReadWriteLock rwlock = new ReentrantReadWriteLock();
-        this.writeLock = rwlock.writeLock();
-        this.readLock = rwlock.readLock();
+        this.fileSystemLock = new ReentrantLock();
     }
 
     private static NativeImageResourcePath toResourcePath(Path path) {
@@ -108,7 +105,7 @@ public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
     @Override
     public FileSystem newFileSystem(URI uri, Map<String, ?> env) {
         try {
-            writeLock.lock();
+            fileSystemLock.lock();
             Path path = uriToPath(uri);
             checkIfResourcePath(path);
             if (fileSystem != null) {
@@ -117,14 +114,14 @@ public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
             fileSystem = new NativeImageResourceFileSystem(this, path, env);
             return fileSystem;
         } finally {
-            writeLock.unlock();
+            fileSystemLock.unlock();
         }
     }
 
     @Override
     public FileSystem newFileSystem(Path path, Map<String, ?> env) {
         try {
-            writeLock.lock();
+            fileSystemLock.lock();
             checkIfResourcePath(path);
             if (fileSystem != null) {
                 throw new FileSystemAlreadyExistsException();
@@ -132,21 +129,17 @@ public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
             fileSystem = new NativeImageResourceFileSystem(this, path, env);
             return fileSystem;
         } finally {
-            writeLock.unlock();
+            fileSystemLock.unlock();
         }
     }
 
     @Override
     public FileSystem getFileSystem(URI uri) {
-        try {
-            readLock.lock();
-            if (fileSystem == null) {
-                throw new FileSystemNotFoundException();
-            }
-            return fileSystem;
-        } finally {
-            readLock.unlock();
+        NativeImageResourceFileSystem result = fileSystem;
+        if (result == null) {
+            throw new FileSystemNotFoundException();
         }
+        return result;
     }
 
     @Override
@@ -250,10 +243,10 @@ public class NativeImageResourceFileSystemProvider extends FileSystemProvider {
 
     void removeFileSystem() {
         try {
-            writeLock.lock();
+            fileSystemLock.lock();
             fileSystem = null;
         } finally {
-            writeLock.unlock();
+            fileSystemLock.unlock();
         }
     }
 }
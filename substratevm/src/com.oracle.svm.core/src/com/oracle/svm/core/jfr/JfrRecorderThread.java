@@ -110,31 +110,49 @@ public class JfrRecorderThread extends Thread {
 
     private void run0() {
         SamplerBuffersAccess.processFullBuffers(true);
+        boolean shouldNotify = false;
         JfrChunkWriter chunkWriter = unlockedChunkWriter.lock();
         try {
             if (chunkWriter.hasOpenFile()) {
-                persistBuffers(chunkWriter);
+                shouldNotify = persistBuffers(chunkWriter);
             }
         } finally {
             chunkWriter.unlock();
         }
+
+        /*
+         * Notify the chunk rotation monitor only after releasing the chunk writer lock. Otherwise,
+         * a thread that holds the monitor and needs the chunk writer (e.g., to rotate the chunk)
+         * would block the recorder thread and all threads waiting for it.
+         */
+        if (shouldNotify) {
+            notifyChunkRotation();
+        }
     }
 
-    @SuppressFBWarnings(value = "NN_NAKED_NOTIFY", justification = "state change is in native buffer")
-    private void persistBuffers(JfrChunkWriter chunkWriter) {
+    /**
+     * Persists the global buffers and returns true if the chunk became large enough that it should
+     * be rotated. Buffers that are currently locked by other threads are skipped instead of waiting
+     * for them, to keep the time in which the chunk writer lock is held short.
+     */
+    private boolean persistBuffers(JfrChunkWriter chunkWriter) {
+        boolean shouldNotify = false;
         JfrBuffers buffers = globalMemory.getBuffers();
         for (int i = 0; i < globalMemory.getBufferCount(); i++) {
             JfrBuffer buffer = buffers.addressOf(i).read();
             if (isFullEnough(buffer)) {
-                boolean shouldNotify = persistBuffer(chunkWriter, buffer);
-                if (shouldNotify) {
-                    Object chunkRotationMonitor = getChunkRotationMonitor();
-                    synchronized (chunkRotationMonitor) {
-                        chunkRotationMonitor.notifyAll();
-                    }
-                }
+                shouldNotify |= persistBuffer(chunkWriter, buffer);
             }
         }
+        return shouldNotify;
+    }
+
+    @SuppressFBWarnings(value = "NN_NAKED_NOTIFY", justification = "state change is in native buffer")
+    private static void notifyChunkRotation() {
+        Object chunkRotationMonitor = getChunkRotationMonitor();
+        synchronized (chunkRotationMonitor) {
+            chunkRotationMonitor.notifyAll();
+        }
     }
 
     private static Object getChunkRotationMonitor() {
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.jfr.sampler;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.compiler.options.Option;
+import org.graalvm.nativeimage.CurrentIsolate;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.Isolate;
+import org.graalvm.nativeimage.IsolateThread;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+import org.graalvm.nativeimage.c.type.WordPointer;
+import org.graalvm.word.UnsignedWord;
+import org.graalvm.word.WordFactory;
+
+import com.oracle.svm.core.IsolateListenerSupport.IsolateListener;
+import com.oracle.svm.core.Isolates;
+import com.oracle.svm.core.SubstrateOptions;
+import com.oracle.svm.core.Uninterruptible;
+import com.oracle.svm.core.c.CGlobalData;
+import com.oracle.svm.core.c.CGlobalDataFactory;
+import com.oracle.svm.core.graal.nodes.WriteCurrentVMThreadNode;
+import com.oracle.svm.core.graal.nodes.WriteHeapBaseNode;
+import com.oracle.svm.core.jfr.SubstrateJVM;
+import com.oracle.svm.core.option.HostedOptionKey;
+import com.oracle.svm.core.thread.ThreadListener;
+import com.oracle.svm.core.thread.VMOperation;
+import com.oracle.svm.core.thread.VMThreads;
+
+/**
+ * An execution sampler that is driven by a profiling timer signal (e.g., {@code SIGPROF}). Unlike
+ * {@link JfrRecurringCallbackExecutionSampler}, the sample is taken wherever the thread was
+ * interrupted, not at the next safepoint check, so the profiles are not biased towards loop
+ * back-edges and method exits.
+ *
+ * The signal handler runs on an arbitrary thread, possibly while it executes native code, so it
+ * cannot rely on the thread and heap base registers. The {@link IsolateThread} is therefore kept
+ * in a native thread-local and the isolate in a {@link CGlobalData}. As signal handlers are global
+ * to the process, only the first isolate can use this sampler.
+ *
+ * The native thread-local is set in {@link #afterAttachThread}, so that the main thread and native
+ * threads that attach to the isolate are sampled as well, and again in {@link #beforeThreadRun}.
+ * It is cleared in {@link #afterThreadRun} and {@link #beforeDetachThread}, after which the
+ * signal handler ignores the thread.
+ */
+public abstract class SubstrateSigprofHandler extends AbstractJfrExecutionSampler implements IsolateListener, ThreadListener {
+    public static class Options {
+        @Option(help = "Use a profiling-timer signal instead of safepoint-based recurring callbacks for JFR execution sampling, where supported.")//
+        public static final HostedOptionKey<Boolean> SignalHandlerBasedExecutionSampler = new HostedOptionKey<>(false);
+    }
+
+    private static final CGlobalData<WordPointer> ISOLATE = CGlobalDataFactory.createWord();
+    private static final CGlobalData<WordPointer> ISOLATE_THREAD_KEY = CGlobalDataFactory.createWord();
+
+    private boolean signalHandlerInstalled;
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    protected SubstrateSigprofHandler() {
+    }
+
+    @Fold
+    static SubstrateSigprofHandler singleton() {
+        return ImageSingletons.lookup(SubstrateSigprofHandler.class);
+    }
+
+    /** Installs the signal handler that calls {@link #tryEnterIsolate} and then samples. */
+    protected abstract void installSignalHandler();
+
+    /** Arms the profiling timer, or disarms it if {@code intervalMillis} is 0. */
+    protected abstract void updateTimer(long intervalMillis);
+
+    @Uninterruptible(reason = "Thread state not yet set up.")
+    protected abstract UnsignedWord createThreadLocalKey();
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    protected abstract void setThreadLocalKeyValue(UnsignedWord key, IsolateThread value);
+
+    @Uninterruptible(reason = "The method executes during signal handling.", mayBeInlined = true)
+    protected abstract IsolateThread getThreadLocalKeyValue(UnsignedWord key);
+
+    @Override
+    @Uninterruptible(reason = "Thread state not yet set up.")
+    public void afterCreateIsolate(Isolate isolate) {
+        if (ISOLATE.get().read().isNull()) {
+            ISOLATE_THREAD_KEY.get().write(createThreadLocalKey());
+            ISOLATE.get().write(isolate);
+        }
+    }
+
+    @Override
+    @Uninterruptible(reason = "Thread state not yet set up.")
+    public void afterAttachThread(IsolateThread thread) {
+        if (isSignalIsolate()) {
+            setThreadLocalKeyValue(ISOLATE_THREAD_KEY.get().read(), thread);
+        }
+    }
+
+    @Override
+    @Uninterruptible(reason = "Thread state no longer set up.")
+    public void beforeDetachThread(IsolateThread thread) {
+        if (isSignalIsolate()) {
+            /* The isolate thread is freed after detaching. */
+            setThreadLocalKeyValue(ISOLATE_THREAD_KEY.get().read(), WordFactory.nullPointer());
+        }
+    }
+
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    private static boolean isSignalIsolate() {
+        Isolate isolate = ISOLATE.get().read();
+        return isolate.equal(CurrentIsolate.getIsolate());
+    }
+
+    @Override
+    protected void startSampling() {
+        assert VMOperation.isInProgressAtSafepoint();
+        if (!isSignalIsolate()) {
+            return;
+        }
+
+        if (!signalHandlerInstalled) {
+            installSignalHandler();
+            signalHandlerInstalled = true;
+        }
+        SubstrateJVM.getSamplerBufferPool().adjustBufferCount();
+
+        for (IsolateThread thread = VMThreads.firstThread(); thread.isNonNull(); thread = VMThreads.nextThread(thread)) {
+            install(thread);
+        }
+        updateTimer(newIntervalMillis);
+    }
+
+    @Override
+    protected void updateInterval() {
+        assert VMOperation.isInProgressAtSafepoint();
+        if (isSignalIsolate()) {
+            updateTimer(newIntervalMillis);
+        }
+    }
+
+    @Override
+    protected void stopSampling() {
+        assert VMOperation.isInProgressAtSafepoint();
+        if (!isSignalIsolate()) {
+            return;
+        }
+
+        updateTimer(0);
+        for (IsolateThread thread = VMThreads.firstThread(); thread.isNonNull(); thread = VMThreads.nextThread(thread)) {
+            uninstall(thread);
+        }
+    }
+
+    @Uninterruptible(reason = "Prevent VM operations that modify the execution sampler.")
+    private static void install(IsolateThread thread) {
+        assert thread == CurrentIsolate.getCurrentThread() || VMOperation.isInProgressAtSafepoint();
+        if (ExecutionSamplerInstallation.isAllowed(thread)) {
+            ExecutionSamplerInstallation.installed(thread);
+        }
+    }
+
+    @Uninterruptible(reason = "Prevent VM operations that modify the execution sampler.")
+    private static void uninstall(IsolateThread thread) {
+        assert thread == CurrentIsolate.getCurrentThread() || VMOperation.isInProgressAtSafepoint();
+        if (ExecutionSamplerInstallation.isInstalled(thread)) {
+            ExecutionSamplerInstallation.uninstalled(thread);
+        }
+    }
+
+    @Override
+    @Uninterruptible(reason = "Prevent VM operations that modify the execution sampler.")
+    public void beforeThreadRun() {
+        if (isSignalIsolate()) {
+            IsolateThread thread = CurrentIsolate.getCurrentThread();
+            setThreadLocalKeyValue(ISOLATE_THREAD_KEY.get().read(), thread);
+            if (isSampling()) {
+                SubstrateJVM.getSamplerBufferPool().adjustBufferCount();
+                install(thread);
+            }
+        }
+    }
+
+    @Override
+    @Uninterruptible(reason = "Prevent VM operations that modify the execution sampler.")
+    public void afterThreadRun() {
+        IsolateThread thread = CurrentIsolate.getCurrentThread();
+        uninstall(thread);
+        ExecutionSamplerInstallation.disallow(thread);
+        if (isSignalIsolate()) {
+            /* From now on, the signal handler ignores this thread. */
+            setThreadLocalKeyValue(ISOLATE_THREAD_KEY.get().read(), WordFactory.nullPointer());
+        }
+    }
+
+    /**
+     * Sets up the heap base and thread registers so that the signal handler can execute Java code.
+     * The interrupted code's registers are restored by the OS when the signal handler returns.
+     *
+     * @return {@code false} if the signal interrupted a thread that is not attached to the isolate.
+     */
+    @Uninterruptible(reason = "The method executes during signal handling.", callerMustBe = true)
+    protected static boolean tryEnterIsolate() {
+        Isolate isolate = ISOLATE.get().read();
+        if (isolate.isNull()) {
+            return false;
+        }
+        IsolateThread thread = singletonUnchecked(isolate).getThreadLocalKeyValue(ISOLATE_THREAD_KEY.get().read());
+        if (thread.isNull()) {
+            return false;
+        }
+        WriteCurrentVMThreadNode.writeCurrentVMThread(thread);
+        return true;
+    }
+
+    /** Writes the heap base before the image singleton is accessed. */
+    @Uninterruptible(reason = "The method executes during signal handling.", callerMustBe = true)
+    private static SubstrateSigprofHandler singletonUnchecked(Isolate isolate) {
+        if (SubstrateOptions.SpawnIsolates.getValue()) {
+            WriteHeapBaseNode.writeCurrentVMHeapBase(Isolates.getHeapBase(isolate));
+        }
+        return singleton();
+    }
+}
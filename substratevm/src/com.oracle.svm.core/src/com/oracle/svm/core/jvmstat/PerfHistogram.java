@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.jvmstat;
+
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
+
+import org.graalvm.nativeimage.PerformanceCounters;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+
+/**
+ * A histogram with fixed bucket limits. Recording a value is lock-free. jvmstat readers only decode
+ * scalar long entries, so every bucket is published as an entry of its own:
+ * <ul>
+ * <li>{@code <name>.limit.<i>}: the inclusive upper limit of bucket {@code i}.</li>
+ * <li>{@code <name>.bucket.<i>}: the number of recorded values in bucket {@code i}. The last bucket,
+ * which has no limit entry, counts the values that are larger than all limits.</li>
+ * <li>{@code <name>.count}: the sum of all buckets.</li>
+ * <li>{@code <name>.sum}: the sum of all recorded values.</li>
+ * </ul>
+ * The limits are written once when the entries are allocated. When sampling, the count is computed
+ * from the sampled bucket counts, so the published count matches the published buckets of the same
+ * sample. The sum is read separately and may include values whose bucket was not counted yet.
+ * External readers access the PerfData memory without any synchronization, so a reader that races
+ * with the sampling thread may still see entries from different samples. Without a
+ * {@link PerfManager}, nothing is published.
+ */
+public final class PerfHistogram implements PerfDataHolder, PerformanceCounters.Histogram {
+    private final long[] limits;
+    private final AtomicLongArray buckets;
+    private final AtomicLong sum;
+
+    private final PerfLongConstant[] limitEntries;
+    private final PerfLongVariable[] bucketEntries;
+    private final PerfLongCounter countEntry;
+    private final PerfLongCounter sumEntry;
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    PerfHistogram(PerfManager manager, String name, PerfUnit unit, long[] limits) {
+        assert limits.length > 0;
+        for (int i = 1; i < limits.length; i++) {
+            assert limits[i - 1] < limits[i] : "bucket limits must be strictly increasing";
+        }
+        this.limits = limits.clone();
+        this.buckets = new AtomicLongArray(limits.length + 1);
+        this.sum = new AtomicLong();
+
+        if (manager != null) {
+            this.limitEntries = new PerfLongConstant[limits.length];
+            for (int i = 0; i < limits.length; i++) {
+                limitEntries[i] = manager.createLongConstant(name + ".limit." + i, unit);
+            }
+            this.bucketEntries = new PerfLongVariable[limits.length + 1];
+            for (int i = 0; i < bucketEntries.length; i++) {
+                bucketEntries[i] = manager.createLongVariable(name + ".bucket." + i, PerfUnit.EVENTS);
+            }
+            this.countEntry = manager.createLongCounter(name + ".count", PerfUnit.EVENTS);
+            this.sumEntry = manager.createLongCounter(name + ".sum", unit);
+        } else {
+            this.limitEntries = null;
+            this.bucketEntries = null;
+            this.countEntry = null;
+            this.sumEntry = null;
+        }
+    }
+
+    @Override
+    public void record(long value) {
+        buckets.getAndIncrement(getBucket(value));
+        sum.getAndAdd(value);
+    }
+
+    @Override
+    public long getCount(int bucket) {
+        return buckets.get(bucket);
+    }
+
+    @Override
+    public long getSum() {
+        return sum.get();
+    }
+
+    private int getBucket(long value) {
+        int low = 0;
+        int high = limits.length;
+        while (low < high) {
+            int mid = (low + high) >>> 1;
+            if (value <= limits[mid]) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+
+    @Override
+    public void allocate() {
+        for (int i = 0; i < limitEntries.length; i++) {
+            limitEntries[i].allocate(limits[i]);
+        }
+        for (PerfLongVariable bucketEntry : bucketEntries) {
+            bucketEntry.allocate();
+        }
+        countEntry.allocate();
+        sumEntry.allocate();
+    }
+
+    @Override
+    public void update() {
+        long count = 0;
+        for (int i = 0; i < bucketEntries.length; i++) {
+            long bucketCount = buckets.get(i);
+            bucketEntries[i].setValue(bucketCount);
+            count += bucketCount;
+        }
+        countEntry.setValue(count);
+        sumEntry.setValue(sum.get());
+    }
+}
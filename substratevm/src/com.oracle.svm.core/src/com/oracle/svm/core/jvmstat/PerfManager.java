@@ -34,6 +34,7 @@ import org.graalvm.collections.EconomicMap;
 import org.graalvm.compiler.options.Option;
 import org.graalvm.compiler.word.Word;
 import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.PerformanceCounters;
 import org.graalvm.nativeimage.Platform;
 import org.graalvm.nativeimage.Platforms;
 import org.graalvm.nativeimage.c.type.CLongPointer;
@@ -97,6 +98,28 @@ public class PerfManager {
         return result;
     }
 
+    /**
+     * Creates a counter for values that are incremented frequently and by many threads. Must be
+     * called at image build time. Applications use {@link PerformanceCounters#createCounter}.
+     */
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public PerfStripedCounter createStripedCounter(String name, PerfUnit unit) {
+        PerfStripedCounter result = new PerfStripedCounter(this, name, unit);
+        register(result);
+        return result;
+    }
+
+    /**
+     * Creates a histogram with the given inclusive upper bucket limits. Must be called at image
+     * build time. Applications use {@link PerformanceCounters#createHistogram}.
+     */
+    @Platforms(Platform.HOSTED_ONLY.class)
+    public PerfHistogram createHistogram(String name, PerfUnit unit, long... bucketLimits) {
+        PerfHistogram result = new PerfHistogram(this, name, unit, bucketLimits);
+        register(result);
+        return result;
+    }
+
     @Platforms(Platform.HOSTED_ONLY.class)
     public PerfStringConstant createStringConstant(String name) {
         return new PerfStringConstant(name);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.jvmstat;
+
+import java.util.concurrent.atomic.AtomicLongArray;
+
+import org.graalvm.nativeimage.PerformanceCounters;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+
+import com.oracle.svm.core.thread.JavaThreads;
+
+/**
+ * A counter for frequently incremented values that is published as a single
+ * {@link PerfLongCounter}. Increments go to one of several stripes (selected by the current thread)
+ * so that concurrent threads rarely contend on the same cache line. The stripes are only summed up
+ * when the performance data is sampled. Without a {@link PerfManager}, nothing is published.
+ */
+public final class PerfStripedCounter implements PerfDataHolder, PerformanceCounters.Counter {
+    private static final int STRIPES = 32;
+    /** Each stripe uses its own cache line to avoid false sharing. */
+    private static final int CELL_STRIDE = 8;
+
+    private final AtomicLongArray cells;
+    private final PerfLongCounter counter;
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    PerfStripedCounter(PerfManager manager, String name, PerfUnit unit) {
+        this.cells = new AtomicLongArray(STRIPES * CELL_STRIDE);
+        this.counter = (manager != null) ? manager.createLongCounter(name, unit) : null;
+    }
+
+    @Override
+    public void increment() {
+        add(1);
+    }
+
+    @Override
+    public void add(long delta) {
+        cells.getAndAdd(getCellIndex(), delta);
+    }
+
+    private static int getCellIndex() {
+        int stripe = (int) JavaThreads.getThreadId(Thread.currentThread()) & (STRIPES - 1);
+        return stripe * CELL_STRIDE;
+    }
+
+    /** Returns the sum of all stripes. Concurrent increments may or may not be included. */
+    @Override
+    public long get() {
+        long sum = 0;
+        for (int i = 0; i < STRIPES; i++) {
+            sum += cells.get(i * CELL_STRIDE);
+        }
+        return sum;
+    }
+
+    @Override
+    public void allocate() {
+        counter.allocate();
+    }
+
+    @Override
+    public void update() {
+        counter.setValue(get());
+    }
+}
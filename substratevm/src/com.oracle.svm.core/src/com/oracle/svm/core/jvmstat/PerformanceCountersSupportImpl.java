@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.jvmstat;
+
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.PerformanceCounters;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+import org.graalvm.nativeimage.impl.PerformanceCountersSupport;
+
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+
+/**
+ * Backs {@link PerformanceCounters} with {@link PerfStripedCounter} and {@link PerfHistogram}. If
+ * the image has no jvmstat support, there is no {@link PerfManager} and the values are only
+ * available to the application.
+ */
+@Platforms(Platform.HOSTED_ONLY.class)
+class PerformanceCountersSupportImpl implements PerformanceCountersSupport {
+    @Override
+    public PerformanceCounters.Counter createCounter(String name) {
+        if (ImageSingletons.contains(PerfManager.class)) {
+            return ImageSingletons.lookup(PerfManager.class).createStripedCounter(name, PerfUnit.EVENTS);
+        }
+        return new PerfStripedCounter(null, name, PerfUnit.EVENTS);
+    }
+
+    @Override
+    public PerformanceCounters.Histogram createHistogram(String name, long[] bucketLimits) {
+        if (ImageSingletons.contains(PerfManager.class)) {
+            return ImageSingletons.lookup(PerfManager.class).createHistogram(name, PerfUnit.NONE, bucketLimits);
+        }
+        return new PerfHistogram(null, name, PerfUnit.NONE, bucketLimits);
+    }
+}
+
+@AutomaticallyRegisteredFeature
+class PerformanceCountersFeature implements InternalFeature {
+    @Override
+    public void afterRegistration(AfterRegistrationAccess access) {
+        ImageSingletons.add(PerformanceCountersSupport.class, new PerformanceCountersSupportImpl());
+    }
+}
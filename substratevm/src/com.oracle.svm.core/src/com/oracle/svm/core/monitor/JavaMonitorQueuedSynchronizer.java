@@ -33,6 +33,7 @@ import java.util.concurrent.locks.LockSupport;
 import com.oracle.svm.core.Uninterruptible;
 import com.oracle.svm.core.jfr.JfrTicks;
 import com.oracle.svm.core.jfr.SubstrateJVM;
+import com.oracle.svm.core.jfr.events.JavaMonitorEnterEvent;
 import com.oracle.svm.core.jfr.events.JavaMonitorWaitEvent;
 import com.oracle.svm.core.thread.JavaThreads;
 
@@ -56,6 +57,10 @@ import jdk.internal.misc.Unsafe;
  * <li>We explicitly treat ForkJoinPool threads in the same way as any other threads because
  * notify/wait should always work the same regardless of the involved thread (see
  * {@link java.util.concurrent.ForkJoinPool#managedBlock}).</li>
+ * <li>The number of spin attempts before a thread parks for the first time is adapted per monitor,
+ * based on whether spinning recently succeeded (see {@link #adaptiveSpins}).</li>
+ * <li>Contended acquisitions and the time spent in them are counted per monitor and reported to
+ * JFR and the {@link MonitorContentionProfiler} (see {@link #acquire(Object, long, long)}).</li>
  * </ul>
  */
 abstract class JavaMonitorQueuedSynchronizer {
@@ -67,6 +72,12 @@ abstract class JavaMonitorQueuedSynchronizer {
     /** Return value of {@link #trySpinAcquire} if successfully acquired. */
     protected static final int SPIN_SUCCESS = -1;
 
+    /** Bounds and step sizes for {@link #adaptiveSpins}. */
+    static final int ADAPTIVE_SPINS_MIN = 1;
+    static final int ADAPTIVE_SPINS_MAX = 0xff;
+    static final int ADAPTIVE_SPINS_BONUS = 16;
+    static final int ADAPTIVE_SPINS_PENALTY = 8;
+
     // see AbstractQueuedLongSynchronizer.Node
     abstract static class Node {
         volatile Node prev;
@@ -141,6 +152,20 @@ abstract class JavaMonitorQueuedSynchronizer {
     private transient volatile Node tail;
     private volatile long state;
 
+    /**
+     * The number of spin attempts before the first park. Increased when spinning acquired the lock
+     * and decreased when the thread had to park anyway. Races on this field are benign, it is only
+     * a heuristic.
+     */
+    private int adaptiveSpins = ADAPTIVE_SPINS_MIN;
+
+    /*
+     * Contention statistics. They are only updated by the thread that just acquired the lock in
+     * the slow path, i.e., while holding the lock, so no atomic updates are needed.
+     */
+    private long contendedAcquisitions;
+    private long contendedNanos;
+
     // see AbstractQueuedLongSynchronizer.getState()
     @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
     protected final long getState() {
@@ -256,12 +281,38 @@ abstract class JavaMonitorQueuedSynchronizer {
         return (1 << parks) - 1;
     }
 
+    private void onSpinSuccess() {
+        int spins = adaptiveSpins + ADAPTIVE_SPINS_BONUS;
+        adaptiveSpins = (spins < ADAPTIVE_SPINS_MAX) ? spins : ADAPTIVE_SPINS_MAX;
+    }
+
+    private void onSpinFailure() {
+        int spins = adaptiveSpins - ADAPTIVE_SPINS_PENALTY;
+        adaptiveSpins = (spins > ADAPTIVE_SPINS_MIN) ? spins : ADAPTIVE_SPINS_MIN;
+    }
+
+    /** Returns the number of acquisitions that had to go through the slow path. */
+    protected final long getContendedAcquisitions() {
+        return contendedAcquisitions;
+    }
+
+    /** Returns the total time that threads spent in the slow path to acquire this monitor. */
+    protected final long getContendedNanos() {
+        return contendedNanos;
+    }
+
     // see AbstractQueuedLongSynchronizer.acquire(Node, long, boolean, boolean, boolean, long)
     @SuppressWarnings("all")
     final int acquire(Node node, long arg) {
         Thread current = Thread.currentThread();
+        /*
+         * Only the first acquisition of a monitor adapts the spin budget. Reacquiring it after a
+         * condition wait does not say anything about spinning.
+         */
+        boolean adaptSpins = (node == null);
+        boolean spun = false;
         int parks = 0;
-        int spins = getSpinAttempts(parks);
+        int spins = adaptSpins ? adaptiveSpins : getSpinAttempts(parks);
         boolean first = false;
         Node pred = null;
 
@@ -277,10 +328,12 @@ abstract class JavaMonitorQueuedSynchronizer {
             }
             if (first || pred == null) {
                 boolean acquired;
+                boolean spinning = (spins > 0);
                 try {
-                    if (spins > 0) {
+                    if (spinning) {
                         spins = trySpinAcquire(spins, arg);
                         acquired = (spins == SPIN_SUCCESS);
+                        spun = true;
                         assert !acquired || isHeldExclusively();
                     } else {
                         acquired = tryAcquire(arg);
@@ -296,6 +349,9 @@ abstract class JavaMonitorQueuedSynchronizer {
                         pred.next = null;
                         node.waiter = null;
                     }
+                    if (adaptSpins && parks == 0 && spinning) {
+                        onSpinSuccess();
+                    }
                     return 1;
                 }
             }
@@ -317,6 +373,9 @@ abstract class JavaMonitorQueuedSynchronizer {
             } else if (node.status == 0) {
                 node.status = WAITING; // enable signal and recheck
             } else {
+                if (adaptSpins && parks == 0 && spun) {
+                    onSpinFailure();
+                }
                 parks++;
                 spins = getSpinAttempts(parks);
                 LockSupport.park(this);
@@ -387,6 +446,24 @@ abstract class JavaMonitorQueuedSynchronizer {
         }
     }
 
+    /**
+     * Like {@link #acquire(long)}, but if the monitor of {@code obj} is contended, the time until
+     * it is acquired is emitted as a JFR JavaMonitorEnter event, which also records the call site,
+     * and reported to the {@link MonitorContentionProfiler}.
+     */
+    protected final void acquire(Object obj, long previousOwnerTid, long arg) {
+        if (!tryAcquire(arg)) {
+            long startTicks = JfrTicks.elapsedTicks();
+            long startNanos = System.nanoTime();
+            acquire(null, arg);
+            long nanos = System.nanoTime() - startNanos;
+            contendedAcquisitions++;
+            contendedNanos += nanos;
+            JavaMonitorEnterEvent.emit(obj, previousOwnerTid, startTicks);
+            MonitorContentionProfiler.singleton().record(obj, nanos);
+        }
+    }
+
     // see AbstractQueuedLongSynchronizer.release(long)
     protected final boolean release(long arg) {
         if (tryRelease(arg)) {
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.monitor;
+
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.compiler.options.Option;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.nativeimage.Platform;
+import org.graalvm.nativeimage.Platforms;
+
+import com.oracle.svm.core.feature.AutomaticallyRegisteredImageSingleton;
+import com.oracle.svm.core.log.Log;
+import com.oracle.svm.core.option.RuntimeOptionKey;
+
+/**
+ * Aggregates the time that threads spent entering contended monitors per class of the monitor
+ * object, and prints the classes with the most contention when the VM shuts down. The call sites
+ * are available from the stack traces of the JFR JavaMonitorEnter events.
+ *
+ * Recording must neither allocate nor lock a monitor, so the classes are kept in a fixed-size
+ * open-addressing table. Contention on classes that no longer fit into the table is only counted
+ * in total.
+ */
+@AutomaticallyRegisteredImageSingleton
+public final class MonitorContentionProfiler {
+    public static class Options {
+        @Option(help = "Record the time spent entering contended monitors per monitor class and print it when the VM shuts down.")//
+        public static final RuntimeOptionKey<Boolean> ProfileMonitorContention = new RuntimeOptionKey<>(false);
+    }
+
+    private static final int CAPACITY = 1024;
+    private static final int MAX_PRINTED_CLASSES = 20;
+
+    private final AtomicReferenceArray<Class<?>> classes = new AtomicReferenceArray<>(CAPACITY);
+    private final AtomicLongArray counts = new AtomicLongArray(CAPACITY);
+    private final AtomicLongArray nanos = new AtomicLongArray(CAPACITY);
+    private final AtomicLong overflowCount = new AtomicLong();
+    private final AtomicLong overflowNanos = new AtomicLong();
+
+    @Platforms(Platform.HOSTED_ONLY.class)
+    MonitorContentionProfiler() {
+    }
+
+    @Fold
+    public static MonitorContentionProfiler singleton() {
+        return ImageSingletons.lookup(MonitorContentionProfiler.class);
+    }
+
+    void record(Object obj, long contendedNanos) {
+        if (!Options.ProfileMonitorContention.getValue()) {
+            return;
+        }
+
+        Class<?> clazz = obj.getClass();
+        int start = System.identityHashCode(clazz) & (CAPACITY - 1);
+        for (int i = 0; i < CAPACITY; i++) {
+            int index = (start + i) & (CAPACITY - 1);
+            Class<?> existing = classes.get(index);
+            if (existing == null && classes.compareAndSet(index, null, clazz)) {
+                existing = clazz;
+            } else if (existing == null) {
+                existing = classes.get(index);
+            }
+            if (existing == clazz) {
+                counts.incrementAndGet(index);
+                nanos.addAndGet(index, contendedNanos);
+                return;
+            }
+        }
+        overflowCount.incrementAndGet();
+        overflowNanos.addAndGet(contendedNanos);
+    }
+
+    void printReport() {
+        if (!Options.ProfileMonitorContention.getValue()) {
+            return;
+        }
+
+        Integer[] indices = new Integer[CAPACITY];
+        int length = 0;
+        for (int i = 0; i < CAPACITY; i++) {
+            if (classes.get(i) != null) {
+                indices[length++] = i;
+            }
+        }
+        Arrays.sort(indices, 0, length, (a, b) -> Long.compare(nanos.get(b), nanos.get(a)));
+
+        Log log = Log.log();
+        log.string("Monitor contention (contended enters, total ms, monitor class):").indent(true);
+        for (int i = 0; i < length && i < MAX_PRINTED_CLASSES; i++) {
+            int index = indices[i];
+            log.signed(counts.get(index)).string("  ").signed(nanos.get(index) / 1_000_000L).string("  ").string(classes.get(index).getName()).newline();
+        }
+        if (length > MAX_PRINTED_CLASSES) {
+            log.string("... ").signed(length - MAX_PRINTED_CLASSES).string(" more classes").newline();
+        }
+        if (overflowCount.get() > 0) {
+            log.signed(overflowCount.get()).string("  ").signed(overflowNanos.get() / 1_000_000L).string("  (classes that did not fit into the table)").newline();
+        }
+        log.redent(false);
+    }
+}
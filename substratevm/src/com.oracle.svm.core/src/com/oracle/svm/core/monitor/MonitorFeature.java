@@ -37,6 +37,7 @@ import com.oracle.svm.core.graal.meta.RuntimeConfiguration;
 import com.oracle.svm.core.graal.meta.SubstrateForeignCallsProvider;
 import com.oracle.svm.core.graal.snippets.NodeLoweringProvider;
 import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.jdk.RuntimeSupport;
 
 @AutomaticallyRegisteredFeature
 public class MonitorFeature implements InternalFeature {
@@ -50,6 +51,11 @@ public class MonitorFeature implements InternalFeature {
         }
     }
 
+    @Override
+    public void beforeAnalysis(BeforeAnalysisAccess access) {
+        RuntimeSupport.getRuntimeSupport().addShutdownHook(isFirstIsolate -> MonitorContentionProfiler.singleton().printReport());
+    }
+
     @Override
     public void registerLowerings(RuntimeConfiguration runtimeConfig, OptionValues options, Providers providers,
                     Map<Class<? extends Node>, NodeLoweringProvider<?>> lowerings, boolean hosted) {
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.core.os;
+
+import org.graalvm.compiler.api.replacements.Fold;
+import org.graalvm.nativeimage.ImageSingletons;
+import org.graalvm.word.PointerBase;
+import org.graalvm.word.UnsignedWord;
+
+import com.oracle.svm.core.Uninterruptible;
+
+/**
+ * Asks the operating system to back a memory range with huge pages. Only platforms that support
+ * transparent huge pages register an implementation, so callers must check
+ * {@link #isSupported()} and treat huge pages as a best-effort optimization.
+ */
+public interface TransparentHugePageSupport {
+    @Fold
+    static boolean isSupported() {
+        return ImageSingletons.contains(TransparentHugePageSupport.class);
+    }
+
+    @Fold
+    static TransparentHugePageSupport get() {
+        return ImageSingletons.lookup(TransparentHugePageSupport.class);
+    }
+
+    /**
+     * Advises the operating system to use huge pages for the given range. The range should be
+     * aligned to the huge page size, otherwise only the aligned part of it can be backed by huge
+     * pages.
+     *
+     * @return {@code true} if the advice was accepted.
+     */
+    @Uninterruptible(reason = "Called from uninterruptible code.", mayBeInlined = true)
+    boolean adviseHugePages(PointerBase start, UnsignedWord nbytes);
+}
@@ -35,6 +35,7 @@ import java.util.Map;
 import com.oracle.graal.pointsto.reports.ReportUtils;
 import com.oracle.svm.core.util.VMError;
 import com.oracle.svm.core.util.json.JsonWriter;
+import com.oracle.svm.hosted.classinitialization.ClassInitializerAnalysisCache;
 
 class ProgressReporterJsonHelper {
     protected static final long UNAVAILABLE_METRIC = -1;
@@ -55,6 +56,14 @@ class ProgressReporterJsonHelper {
         putResourceUsage(ResourceUsageKey.MEMORY_TOTAL, getTotalSystemMemory());
     }
 
+    private void recordClassInitializerAnalysisCache() {
+        ClassInitializerAnalysisCache cache = ClassInitializerAnalysisCache.singleton();
+        if (cache != null) {
+            putAnalysisResults(AnalysisResults.CLASS_INITIALIZER_CACHE_HITS, cache.getHits());
+            putAnalysisResults(AnalysisResults.CLASS_INITIALIZER_CACHE_MISSES, cache.getMisses());
+        }
+    }
+
     @SuppressWarnings("deprecation")
     private static long getTotalSystemMemory() {
         OperatingSystemMXBean osMXBean = ManagementFactory.getOperatingSystemMXBean();
@@ -104,6 +113,7 @@ class ProgressReporterJsonHelper {
 
     public Path printToFile() {
         recordSystemFixedValues();
+        recordClassInitializerAnalysisCache();
         String description = "image statistics in json";
         return ReportUtils.report(description, jsonOutputFile.toAbsolutePath(), out -> {
             try {
@@ -182,6 +192,8 @@ class ProgressReporterJsonHelper {
         FIELD_REACHABLE("fields", "reachable"),
         FIELD_JNI("fields", "jni"),
         FIELD_REFLECT("fields", "reflection"),
+        CLASS_INITIALIZER_CACHE_HITS("class_initializer_cache", "hits"),
+        CLASS_INITIALIZER_CACHE_MISSES("class_initializer_cache", "misses"),
 
         // TODO GR-42148: remove deprecated entries in a future release
         DEPRECATED_CLASS_TOTAL("classes", "total"),
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.hosted.classinitialization;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Predicate;
+
+import org.graalvm.collections.UnmodifiableMapCursor;
+import org.graalvm.compiler.options.Option;
+import org.graalvm.compiler.options.OptionKey;
+import org.graalvm.nativeimage.ImageSingletons;
+
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.option.HostedOptionKey;
+import com.oracle.svm.core.option.HostedOptionValues;
+import com.oracle.svm.core.util.VMError;
+
+/**
+ * Persists the results of the {@link EarlyClassInitializerAnalysis} across image builds, so that
+ * the class initializers of unchanged classes (e.g., from library jars that are the same in every
+ * build) do not have to be parsed again.
+ * <p>
+ * The result for a class depends on the bytecode of its class initializer and of all classes it
+ * refers to, calls or inlines. The cache therefore stores, for each class, the digest of its class
+ * file and the digests of the class files of all these dependencies; an entry is only used if all
+ * digests still match.
+ * <p>
+ * Only positive results are cached. On a hit, every dependency that is not yet initialized goes
+ * through the same check as during the analysis and is initialized again, so the side effects of
+ * the analysis are replayed. This check also applies the current class initialization
+ * configuration (e.g., {@code --initialize-at-run-time}), which is therefore not part of the key: a
+ * dependency that is now initialized at run time invalidates the entry. The check is only done
+ * after the digests of all dependencies matched, so that a stale entry does not initialize any
+ * class. Negative results are not cached because the analysis may have initialized some
+ * dependencies before it gave up. Classes without a class file (e.g., hidden classes) are never
+ * cached.
+ * <p>
+ * The file is only used by a builder of the same version and with the same hosted options, see
+ * {@link #computeBuilderDigest()}. The number of hits and misses is part of the build output JSON.
+ */
+public final class ClassInitializerAnalysisCache {
+
+    static final class Options {
+        @Option(help = "File used to cache the results of the early class initializer analysis across image builds.")//
+        static final HostedOptionKey<String> ClassInitializerAnalysisCache = new HostedOptionKey<>("");
+    }
+
+    private static final int MAGIC = 0x43494333; // "CIC3"
+
+    private static final class Entry {
+        final String digest;
+        final Map<String, String> dependencies;
+
+        Entry(String digest, Map<String, String> dependencies) {
+            this.digest = digest;
+            this.dependencies = dependencies;
+        }
+    }
+
+    private final Path file;
+    private final String builderDigest;
+    private final Map<String, Entry> entries = new ConcurrentHashMap<>();
+    private final Map<Class<?>, Optional<String>> digests = new ConcurrentHashMap<>();
+    private final AtomicInteger hits = new AtomicInteger();
+    private final AtomicInteger misses = new AtomicInteger();
+
+    private ClassInitializerAnalysisCache(Path file) {
+        this.file = file;
+        this.builderDigest = computeBuilderDigest();
+    }
+
+    /** Returns the cache, or null if it is not enabled. */
+    public static ClassInitializerAnalysisCache singleton() {
+        return ImageSingletons.contains(ClassInitializerAnalysisCache.class) ? ImageSingletons.lookup(ClassInitializerAnalysisCache.class) : null;
+    }
+
+    /**
+     * Returns true if there is a valid entry, i.e., the class is known to be safe to initialize at
+     * image build time. {@code canInitialize} is called for every dependency and initializes it if
+     * necessary.
+     */
+    boolean lookup(Class<?> clazz, Predicate<Class<?>> canInitialize) {
+        Entry entry = entries.get(clazz.getName());
+        if (entry == null || !entry.digest.equals(digest(clazz).orElse(null)) || !dependenciesUnchanged(clazz, entry, canInitialize)) {
+            misses.incrementAndGet();
+            return false;
+        }
+        hits.incrementAndGet();
+        return true;
+    }
+
+    public int getHits() {
+        return hits.get();
+    }
+
+    public int getMisses() {
+        return misses.get();
+    }
+
+    private boolean dependenciesUnchanged(Class<?> clazz, Entry entry, Predicate<Class<?>> canInitialize) {
+        List<Class<?>> dependencyClasses = new ArrayList<>(entry.dependencies.size());
+        for (Map.Entry<String, String> dependency : entry.dependencies.entrySet()) {
+            Class<?> dependencyClass;
+            try {
+                dependencyClass = Class.forName(dependency.getKey(), false, clazz.getClassLoader());
+            } catch (ClassNotFoundException | LinkageError e) {
+                return false;
+            }
+            if (!dependency.getValue().equals(digest(dependencyClass).orElse(null))) {
+                return false;
+            }
+            dependencyClasses.add(dependencyClass);
+        }
+        /* Only replay the initialization once the whole entry is known to be valid. */
+        for (Class<?> dependencyClass : dependencyClasses) {
+            if (!canInitialize.test(dependencyClass)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Records that the analysis proved the class safe to initialize at image build time. */
+    void put(Class<?> clazz, Set<Class<?>> dependencies) {
+        Optional<String> digest = digest(clazz);
+        if (digest.isEmpty()) {
+            return;
+        }
+        Map<String, String> dependencyDigests = new ConcurrentHashMap<>();
+        for (Class<?> dependency : dependencies) {
+            if (dependency == clazz) {
+                continue;
+            }
+            Optional<String> dependencyDigest = digest(dependency);
+            if (dependencyDigest.isEmpty()) {
+                return;
+            }
+            dependencyDigests.put(dependency.getName(), dependencyDigest.get());
+        }
+        entries.put(clazz.getName(), new Entry(digest.get(), dependencyDigests));
+    }
+
+    private Optional<String> digest(Class<?> clazz) {
+        return digests.computeIfAbsent(clazz, ClassInitializerAnalysisCache::computeDigest);
+    }
+
+    private static Optional<String> computeDigest(Class<?> clazz) {
+        if (clazz.isArray() || clazz.isPrimitive()) {
+            return Optional.empty();
+        }
+        /*
+         * Class files are never encapsulated, so this also works for classes of named modules.
+         * Hidden classes have no class file.
+         */
+        try (InputStream in = clazz.getResourceAsStream('/' + clazz.getName().replace('.', '/') + ".class")) {
+            if (in == null) {
+                return Optional.empty();
+            }
+            MessageDigest digest = newDigest();
+            digest.update(in.readAllBytes());
+            return Optional.of(toHex(digest));
+        } catch (IOException e) {
+            return Optional.empty();
+        }
+    }
+
+    /**
+     * Digest of everything besides the class files that the cached results depend on: the version
+     * of the builder and of its JDK, the class files of the analysis itself, and the hosted options.
+     * Any change of a hosted option conservatively invalidates the whole cache.
+     */
+    private static String computeBuilderDigest() {
+        StringBuilder key = new StringBuilder();
+        key.append(System.getProperty("java.vm.version")).append('\n');
+        key.append(System.getProperty("org.graalvm.version")).append('\n');
+        for (Class<?> analysisClass : new Class<?>[]{EarlyClassInitializerAnalysis.class, ClassInitializerAnalysisCache.class}) {
+            key.append(computeDigest(analysisClass).orElse("")).append('\n');
+        }
+        List<String> options = new ArrayList<>();
+        UnmodifiableMapCursor<OptionKey<?>, Object> cursor = HostedOptionValues.singleton().getMap().getEntries();
+        while (cursor.advance()) {
+            if (cursor.getKey() != Options.ClassInitializerAnalysisCache) {
+                options.add(cursor.getKey().getName() + "=" + cursor.getValue());
+            }
+        }
+        options.sort(Comparator.naturalOrder());
+        for (String option : options) {
+            key.append(option).append('\n');
+        }
+        MessageDigest digest = newDigest();
+        digest.update(key.toString().getBytes(StandardCharsets.UTF_8));
+        return toHex(digest);
+    }
+
+    private static MessageDigest newDigest() {
+        try {
+            return MessageDigest.getInstance("SHA-256");
+        } catch (NoSuchAlgorithmException e) {
+            throw VMError.shouldNotReachHere(e);
+        }
+    }
+
+    private static String toHex(MessageDigest digest) {
+        StringBuilder result = new StringBuilder();
+        for (byte b : digest.digest()) {
+            result.append(String.format("%02x", b & 0xff));
+        }
+        return result.toString();
+    }
+
+    private void load() {
+        try (DataInputStream in = new DataInputStream(new BufferedInputStream(Files.newInputStream(file)))) {
+            if (in.readInt() != MAGIC || !in.readUTF().equals(builderDigest)) {
+                /* Written by a different builder or with different options. */
+                return;
+            }
+            int count = in.readInt();
+            for (int i = 0; i < count; i++) {
+                String name = in.readUTF();
+                String digest = in.readUTF();
+                int dependencyCount = in.readInt();
+                Map<String, String> dependencies = new ConcurrentHashMap<>();
+                for (int j = 0; j < dependencyCount; j++) {
+                    dependencies.put(in.readUTF(), in.readUTF());
+                }
+                entries.put(name, new Entry(digest, dependencies));
+            }
+        } catch (NoSuchFileException e) {
+            /* First build with this cache. */
+        } catch (IOException e) {
+            /* A corrupt cache is not an error, the classes are simply analyzed again. */
+            entries.clear();
+        }
+    }
+
+    private void store() {
+        Path tmp = file.resolveSibling(file.getFileName() + ".tmp");
+        try {
+            if (file.getParent() != null) {
+                Files.createDirectories(file.getParent());
+            }
+            try (DataOutputStream out = new DataOutputStream(new BufferedOutputStream(Files.newOutputStream(tmp)))) {
+                out.writeInt(MAGIC);
+                out.writeUTF(builderDigest);
+                out.writeInt(entries.size());
+                for (Map.Entry<String, Entry> mapEntry : entries.entrySet()) {
+                    Entry entry = mapEntry.getValue();
+                    out.writeUTF(mapEntry.getKey());
+                    out.writeUTF(entry.digest);
+                    out.writeInt(entry.dependencies.size());
+                    for (Map.Entry<String, String> dependency : entry.dependencies.entrySet()) {
+                        out.writeUTF(dependency.getKey());
+                        out.writeUTF(dependency.getValue());
+                    }
+                }
+            }
+            Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+        } catch (IOException e) {
+            /* The image itself is not affected, the next build only runs without the cache. */
+            System.out.printf("Warning: Cannot write class initializer analysis cache %s: %s%n", file, e.getMessage());
+            try {
+                Files.deleteIfExists(tmp);
+            } catch (IOException ignored) {
+                /* Nothing left to do. */
+            }
+        }
+    }
+
+    @AutomaticallyRegisteredFeature
+    static final class CacheFeature implements InternalFeature {
+        @Override
+        public boolean isInConfiguration(IsInConfigurationAccess access) {
+            return !Options.ClassInitializerAnalysisCache.getValue().isEmpty();
+        }
+
+        @Override
+        public void afterRegistration(AfterRegistrationAccess access) {
+            ClassInitializerAnalysisCache cache = new ClassInitializerAnalysisCache(Paths.get(Options.ClassInitializerAnalysisCache.getValue()).toAbsolutePath());
+            cache.load();
+            ImageSingletons.add(ClassInitializerAnalysisCache.class, cache);
+        }
+
+        @Override
+        public void onAnalysisExit(OnAnalysisExitAccess access) {
+            ImageSingletons.lookup(ClassInitializerAnalysisCache.class).store();
+        }
+    }
+}
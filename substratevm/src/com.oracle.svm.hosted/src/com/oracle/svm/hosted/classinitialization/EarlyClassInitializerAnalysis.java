@@ -51,6 +51,7 @@ import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderConfiguration.Plu
 import org.graalvm.compiler.nodes.graphbuilderconf.GraphBuilderContext;
 import org.graalvm.compiler.nodes.graphbuilderconf.InlineInvokePlugin;
 import org.graalvm.compiler.nodes.graphbuilderconf.InvocationPlugins;
+import org.graalvm.compiler.nodes.graphbuilderconf.NodePlugin;
 import org.graalvm.compiler.nodes.java.AccessFieldNode;
 import org.graalvm.compiler.nodes.java.NewArrayNode;
 import org.graalvm.compiler.nodes.java.NewMultiArrayNode;
@@ -156,21 +157,48 @@ final class EarlyClassInitializerAnalysis {
         }
         analyzedClasses.add(clazz);
 
+        ClassInitializerAnalysisCache cache = ClassInitializerAnalysisCache.singleton();
+        Set<Class<?>> dependencies = null;
+        boolean useCache = cache != null && !classInitializationSupport.mustNotBeProvenSafe.contains(clazz);
+        if (useCache) {
+            Set<Class<?>> analyzed = analyzedClasses;
+            if (cache.lookup(clazz, dependency -> canBeInitialized(dependency, analyzed))) {
+                return true;
+            }
+            dependencies = new HashSet<>();
+        }
+
         OptionValues options = HostedOptionValues.singleton();
         DebugContext debug = new Builder(options).build();
+        boolean result;
         try (DebugContext.Scope s = debug.scope("EarlyClassInitializerAnalysis", clinit)) {
-            return canInitializeWithoutSideEffects(clinit, analyzedClasses, options, debug);
+            result = canInitializeWithoutSideEffects(clinit, analyzedClasses, dependencies, options, debug);
         } catch (Throwable ex) {
             throw debug.handle(ex);
         }
+        if (useCache && result) {
+            cache.put(clazz, dependencies);
+        }
+        return result;
+    }
+
+    /** Same check as {@link AbortOnUnitializedClassPlugin}, for a cached dependency. */
+    private boolean canBeInitialized(Class<?> dependency, Set<Class<?>> analyzedClasses) {
+        ResolvedJavaType type = originalProviders.getMetaAccess().lookupJavaType(dependency);
+        return type.isInitialized() || classInitializationSupport.computeInitKindAndMaybeInitializeClass(dependency, true, analyzedClasses) != InitKind.RUN_TIME;
     }
 
     @SuppressWarnings("try")
-    private boolean canInitializeWithoutSideEffects(ResolvedJavaMethod clinit, Set<Class<?>> analyzedClasses, OptionValues options, DebugContext debug) {
+    private boolean canInitializeWithoutSideEffects(ResolvedJavaMethod clinit, Set<Class<?>> analyzedClasses, Set<Class<?>> dependencies, OptionValues options, DebugContext debug) {
         InvocationPlugins invocationPlugins = new InvocationPlugins();
         Plugins plugins = new Plugins(invocationPlugins);
+        if (dependencies != null) {
+            RecordDependenciesPlugin recordDependenciesPlugin = new RecordDependenciesPlugin(dependencies);
+            plugins.prependInlineInvokePlugin(recordDependenciesPlugin);
+            plugins.appendNodePlugin(recordDependenciesPlugin);
+        }
         plugins.appendInlineInvokePlugin(new AbortOnRecursiveInliningPlugin());
-        AbortOnUnitializedClassPlugin classInitializationPlugin = new AbortOnUnitializedClassPlugin(analyzedClasses);
+        AbortOnUnitializedClassPlugin classInitializationPlugin = new AbortOnUnitializedClassPlugin(analyzedClasses, dependencies);
         plugins.setClassInitializationPlugin(classInitializationPlugin);
         plugins.appendNodePlugin(new EarlyConstantFoldLoadFieldPlugin(originalProviders.getMetaAccess()));
 
@@ -213,9 +241,11 @@ final class EarlyClassInitializerAnalysis {
     final class AbortOnUnitializedClassPlugin extends NoClassInitializationPlugin {
 
         private final Set<Class<?>> analyzedClasses;
+        private final Set<Class<?>> dependencies;
 
-        AbortOnUnitializedClassPlugin(Set<Class<?>> analyzedClasses) {
+        AbortOnUnitializedClassPlugin(Set<Class<?>> analyzedClasses, Set<Class<?>> dependencies) {
             this.analyzedClasses = analyzedClasses;
+            this.dependencies = dependencies;
         }
 
         @Override
@@ -224,6 +254,9 @@ final class EarlyClassInitializerAnalysis {
             if (!EnsureClassInitializedNode.needsRuntimeInitialization(clinitMethod.getDeclaringClass(), type)) {
                 return false;
             }
+            if (dependencies != null) {
+                dependencies.add(ProvenSafeClassInitializationSupport.getJavaClass(type));
+            }
             if (classInitializationSupport.computeInitKindAndMaybeInitializeClass(ProvenSafeClassInitializationSupport.getJavaClass(type), true, analyzedClasses) != InitKind.RUN_TIME) {
                 assert type.isInitialized() : "Type must be initialized now";
                 return false;
@@ -248,6 +281,52 @@ final class ClassInitializerHasSideEffectsException extends GraalBailoutExceptio
     }
 }
 
+/**
+ * Records the classes whose code or constants the result of the analysis depends on, see
+ * {@link ClassInitializerAnalysisCache}. Never makes a decision itself.
+ */
+final class RecordDependenciesPlugin implements InlineInvokePlugin, NodePlugin {
+    private final Set<Class<?>> dependencies;
+
+    RecordDependenciesPlugin(Set<Class<?>> dependencies) {
+        this.dependencies = dependencies;
+    }
+
+    private void record(ResolvedJavaType type) {
+        dependencies.add(OriginalClassProvider.getJavaClass(type));
+    }
+
+    @Override
+    public InlineInfo shouldInlineInvoke(GraphBuilderContext b, ResolvedJavaMethod original, ValueNode[] arguments) {
+        record(original.getDeclaringClass());
+        return null;
+    }
+
+    @Override
+    public boolean handleInvoke(GraphBuilderContext b, ResolvedJavaMethod method, ValueNode[] args) {
+        record(method.getDeclaringClass());
+        return false;
+    }
+
+    @Override
+    public boolean handleLoadStaticField(GraphBuilderContext b, ResolvedJavaField field) {
+        record(field.getDeclaringClass());
+        return false;
+    }
+
+    @Override
+    public boolean handleStoreStaticField(GraphBuilderContext b, ResolvedJavaField field, ValueNode value) {
+        record(field.getDeclaringClass());
+        return false;
+    }
+
+    @Override
+    public boolean handleNewInstance(GraphBuilderContext b, ResolvedJavaType type) {
+        record(type);
+        return false;
+    }
+}
+
 final class AbortOnRecursiveInliningPlugin implements InlineInvokePlugin {
     @Override
     public InlineInfo shouldInlineInvoke(GraphBuilderContext b, ResolvedJavaMethod original, ValueNode[] arguments) {
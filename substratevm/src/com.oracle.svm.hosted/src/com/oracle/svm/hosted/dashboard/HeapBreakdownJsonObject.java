@@ -31,6 +31,9 @@ import com.oracle.svm.hosted.dashboard.ToJson.JsonValue;
 import com.oracle.svm.hosted.dashboard.ToJson.JsonArray;
 import com.oracle.svm.hosted.FeatureImpl;
 import com.oracle.svm.hosted.image.NativeImageHeap;
+import com.oracle.svm.hosted.image.StringBackingArrayDeduplicationFeature;
+import com.oracle.svm.hosted.image.StringBackingArrayDeduplicationFeature.SavedSize;
+import org.graalvm.nativeimage.ImageSingletons;
 import org.graalvm.nativeimage.hosted.Feature;
 
 import java.util.Arrays;
@@ -49,8 +52,13 @@ class HeapBreakdownJsonObject extends JsonObject {
     private static final String INFO_SIZE = "size";
     private static final String INFO_COUNT = "count";
     private static final List<String> NAMES = Arrays.asList(INFO_NAME, INFO_SIZE, INFO_COUNT);
+    private static final String HEAP_SIZE = "heap-size";
+    private static final String STRING_DEDUPLICATION = "string-deduplication";
+    private static final String INFO_PARTITION = "partition";
+    private static final String INFO_SAVED_SIZE = "saved-size";
 
     private final HashMap<String, Statistics> sizes = new HashMap<>();
+    private final HashMap<String, Statistics> sharedStringValues = new HashMap<>();
 
     HeapBreakdownJsonObject(Feature.AfterHeapLayoutAccess access) {
         this.access = access;
@@ -62,12 +70,47 @@ class HeapBreakdownJsonObject extends JsonObject {
 
     @Override
     Stream<String> getNames() {
-        return Arrays.asList("heap-size").stream();
+        return Arrays.asList(HEAP_SIZE, STRING_DEDUPLICATION).stream();
     }
 
     @Override
     JsonValue getValue(String name) {
-        return JsonArray.get(sizes.entrySet().stream().map(ClassJsonObject::new));
+        switch (name) {
+            case HEAP_SIZE:
+                return JsonArray.get(sizes.entrySet().stream().map(ClassJsonObject::new));
+            case STRING_DEDUPLICATION:
+                return JsonArray.get(sharedStringValues.entrySet().stream().map(StringDeduplicationJsonObject::new));
+            default:
+                return null;
+        }
+    }
+
+    private static class StringDeduplicationJsonObject extends JsonObject {
+
+        private final Map.Entry<String, Statistics> entry;
+
+        StringDeduplicationJsonObject(Map.Entry<String, Statistics> entry) {
+            this.entry = entry;
+        }
+
+        @Override
+        Stream<String> getNames() {
+            return Arrays.asList(INFO_PARTITION, INFO_COUNT, INFO_SAVED_SIZE).stream();
+        }
+
+        @Override
+        JsonValue getValue(String name) {
+            switch (name) {
+                case INFO_PARTITION:
+                    return JsonString.get(entry.getKey());
+                case INFO_COUNT:
+                    return JsonNumber.get(entry.getValue().count);
+                case INFO_SAVED_SIZE:
+                    return JsonNumber.get(entry.getValue().size);
+                default:
+                    return null;
+            }
+        }
     }
 
     private static class ClassJsonObject extends JsonObject {
@@ -121,6 +164,14 @@ class HeapBreakdownJsonObject extends JsonObject {
             stats.size += info.getSize();
             stats.count += 1;
         }
+        if (ImageSingletons.contains(StringBackingArrayDeduplicationFeature.class)) {
+            for (Map.Entry<String, SavedSize> entry : ImageSingletons.lookup(StringBackingArrayDeduplicationFeature.class).getSavedSizes().entrySet()) {
+                Statistics stats = new Statistics();
+                stats.size = entry.getValue().getSize();
+                stats.count = entry.getValue().getCount();
+                sharedStringValues.put(entry.getKey(), stats);
+            }
+        }
         access = null;
         built = true;
     }
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.hosted.image;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+import org.graalvm.collections.Pair;
+import org.graalvm.compiler.code.CompilationResult;
+import org.graalvm.compiler.options.Option;
+
+import com.oracle.svm.core.option.HostedOptionKey;
+import com.oracle.svm.core.util.UserError;
+import com.oracle.svm.hosted.meta.HostedMethod;
+
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.jfr.consumer.RecordedMethod;
+import jdk.jfr.consumer.RecordedStackTrace;
+import jdk.jfr.consumer.RecordingFile;
+import jdk.vm.ci.meta.JavaKind;
+
+/**
+ * Orders the compiled methods of the image so that methods that call each other frequently are
+ * placed next to each other, and hot code as a whole is contiguous at the start of the code area.
+ * This reduces the number of pages and iTLB entries that hot code touches.
+ *
+ * The order is computed with call-chain clustering (C3, Ottoni and Maher, CGO 2017) from a
+ * call-graph profile: each method starts in its own cluster; methods are visited in order of
+ * decreasing hotness, and the cluster of a method is appended to the cluster of its most frequent
+ * caller unless the merged cluster would exceed {@link #MAX_CLUSTER_SIZE}. Finally, clusters are
+ * sorted by decreasing density (samples per byte). Methods that do not occur in the profile keep
+ * their default order and are placed after all profiled methods.
+ *
+ * The profile is either a JFR recording of the image, or a text file. From a JFR recording, every
+ * {@code jdk.ExecutionSample} event counts as one call from the compiled method below the sampled
+ * one, so a profile can be recorded by running the image with
+ * {@code -XX:+FlightRecorder -XX:StartFlightRecording=filename=profile.jfr}. The text file has one
+ * call edge per line: the caller, the callee and the number of calls (or samples), separated by
+ * tabs. Methods are identified by {@code %H.%n(%P)}, see {@link HostedMethod#format}. Lines
+ * starting with {@code #} are ignored. Methods of the image that share the same name, e.g., bridge
+ * methods that only differ in the return type, cannot be told apart and are not ordered.
+ *
+ * With {@link Options#SplitColdCode}, the methods without profile start at a huge page boundary of
+ * the code area, so that hot and cold code do not share huge pages if the code area itself is
+ * aligned to huge pages, see {@link Options#AlignCodeToHugePages}.
+ */
+final class CallChainClusteringOrder {
+
+    static final class Options {
+        @Option(help = "Call-graph profile used to order the methods of the image for better code locality: a JFR recording with execution samples, or a text file. See CallChainClusteringOrder for the format.")//
+        static final HostedOptionKey<String> CodeLayoutProfile = new HostedOptionKey<>("");
+
+        @Option(help = "Start the methods that are not in the CodeLayoutProfile at a 2 MB boundary of the code area, separate from the hot code.")//
+        static final HostedOptionKey<Boolean> SplitColdCode = new HostedOptionKey<>(false);
+
+        @Option(help = "Align the code area of the image to 2 MB, so that it can be backed by transparent huge pages.")//
+        static final HostedOptionKey<Boolean> AlignCodeToHugePages = new HostedOptionKey<>(false);
+    }
+
+    static final int HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * Do not merge clusters beyond this size, so that a single hot call chain does not absorb all
+     * profiled methods and the ordering by density still matters. Clusters are not aligned, so a
+     * cluster of this size usually spans two huge pages.
+     */
+    private static final long MAX_CLUSTER_SIZE = 2 * 1024 * 1024;
+
+    private static final String EXECUTION_SAMPLE_EVENT = "jdk.ExecutionSample";
+    private static final String INLINED_FRAME_TYPE = "Inlined";
+
+    private static final class Cluster {
+        final List<HostedMethod> methods = new ArrayList<>();
+        long size;
+        long samples;
+
+        double density() {
+            return (double) samples / Math.max(size, 1);
+        }
+    }
+
+    private final List<Pair<HostedMethod, CompilationResult>> order;
+    private final int profiledMethodCount;
+
+    private CallChainClusteringOrder(List<Pair<HostedMethod, CompilationResult>> order, int profiledMethodCount) {
+        this.order = order;
+        this.profiledMethodCount = profiledMethodCount;
+    }
+
+    static boolean isEnabled() {
+        return !Options.CodeLayoutProfile.getValue().isEmpty();
+    }
+
+    static boolean splitColdCode() {
+        return Options.SplitColdCode.getValue();
+    }
+
+    /** Returns the alignment of the section that contains the code area. */
+    static int codeSectionAlignment(int pageSize) {
+        return Options.AlignCodeToHugePages.getValue() ? Math.max(pageSize, HUGE_PAGE_SIZE) : pageSize;
+    }
+
+    /** The compilations in profile-guided order. */
+    List<Pair<HostedMethod, CompilationResult>> getOrder() {
+        return order;
+    }
+
+    /** The number of methods at the start of the {@link #getOrder() order} that have a profile. */
+    int getProfiledMethodCount() {
+        return profiledMethodCount;
+    }
+
+    /**
+     * Computes the profile-guided order of the compilations. {@code defaultOrder} determines the
+     * order of methods without profile and breaks ties.
+     */
+    static CallChainClusteringOrder computeOrder(List<Pair<HostedMethod, CompilationResult>> defaultOrder) {
+        Map<String, HostedMethod> methodsByName = new HashMap<>();
+        Set<String> ambiguousNames = new HashSet<>();
+        Map<HostedMethod, CompilationResult> compilations = new IdentityHashMap<>();
+        Map<HostedMethod, Integer> defaultPositions = new IdentityHashMap<>();
+        for (Pair<HostedMethod, CompilationResult> entry : defaultOrder) {
+            String name = entry.getLeft().format("%H.%n(%P)");
+            if (!ambiguousNames.contains(name) && methodsByName.putIfAbsent(name, entry.getLeft()) != null) {
+                methodsByName.remove(name);
+                ambiguousNames.add(name);
+            }
+            compilations.put(entry.getLeft(), entry.getRight());
+            defaultPositions.put(entry.getLeft(), defaultPositions.size());
+        }
+        if (!ambiguousNames.isEmpty()) {
+            System.out.printf("Warning: %d method names of the image are ambiguous, the profile of these methods is ignored in the code layout, e.g., %s%n",
+                            ambiguousNames.size(), ambiguousNames.iterator().next());
+        }
+
+        Map<HostedMethod, Long> samples = new IdentityHashMap<>();
+        Map<HostedMethod, HostedMethod> hottestCaller = new IdentityHashMap<>();
+        Map<HostedMethod, Long> hottestCallerCount = new IdentityHashMap<>();
+        for (String[] edge : readProfile()) {
+            HostedMethod caller = methodsByName.get(edge[0]);
+            HostedMethod callee = methodsByName.get(edge[1]);
+            if (caller == null || callee == null) {
+                /* Not compiled into this image, e.g., inlined everywhere. */
+                continue;
+            }
+            long count = parseCount(edge[2]);
+            samples.merge(callee, count, Long::sum);
+            samples.putIfAbsent(caller, 0L);
+            if (caller != callee && count > hottestCallerCount.getOrDefault(callee, 0L)) {
+                hottestCaller.put(callee, caller);
+                hottestCallerCount.put(callee, count);
+            }
+        }
+
+        Map<HostedMethod, Cluster> clusterOf = new IdentityHashMap<>();
+        List<HostedMethod> hotMethods = new ArrayList<>(samples.keySet());
+        hotMethods.sort(Comparator.comparingLong((HostedMethod m) -> samples.get(m)).reversed().thenComparingInt(defaultPositions::get));
+        for (HostedMethod method : hotMethods) {
+            Cluster cluster = new Cluster();
+            cluster.methods.add(method);
+            cluster.size = compilations.get(method).getTargetCodeSize();
+            cluster.samples = samples.get(method);
+            clusterOf.put(method, cluster);
+        }
+        for (HostedMethod method : hotMethods) {
+            HostedMethod caller = hottestCaller.get(method);
+            if (caller == null) {
+                continue;
+            }
+            Cluster calleeCluster = clusterOf.get(method);
+            Cluster callerCluster = clusterOf.get(caller);
+            if (calleeCluster == callerCluster || callerCluster.size + calleeCluster.size > MAX_CLUSTER_SIZE) {
+                continue;
+            }
+            callerCluster.methods.addAll(calleeCluster.methods);
+            callerCluster.size += calleeCluster.size;
+            callerCluster.samples += calleeCluster.samples;
+            for (HostedMethod moved : calleeCluster.methods) {
+                clusterOf.put(moved, callerCluster);
+            }
+        }
+
+        List<Cluster> clusters = new ArrayList<>();
+        for (HostedMethod method : hotMethods) {
+            Cluster cluster = clusterOf.get(method);
+            if (cluster.methods.get(0) == method) {
+                clusters.add(cluster);
+            }
+        }
+        clusters.sort(Comparator.comparingDouble(Cluster::density).reversed());
+
+        List<Pair<HostedMethod, CompilationResult>> result = new ArrayList<>(defaultOrder.size());
+        for (Cluster cluster : clusters) {
+            for (HostedMethod method : cluster.methods) {
+                result.add(Pair.create(method, compilations.get(method)));
+            }
+        }
+        for (Pair<HostedMethod, CompilationResult> entry : defaultOrder) {
+            if (!samples.containsKey(entry.getLeft())) {
+                result.add(entry);
+            }
+        }
+        assert result.size() == defaultOrder.size();
+        return new CallChainClusteringOrder(result, samples.size());
+    }
+
+    private static List<String[]> readProfile() {
+        Path profile = Paths.get(Options.CodeLayoutProfile.getValue());
+        if (profile.getFileName().toString().endsWith(".jfr")) {
+            return readJfrProfile(profile);
+        }
+        List<String[]> edges = new ArrayList<>();
+        try {
+            for (String line : Files.readAllLines(profile)) {
+                if (line.isBlank() || line.startsWith("#")) {
+                    continue;
+                }
+                String[] edge = line.split("\t");
+                if (edge.length != 3) {
+                    throw UserError.abort("Invalid line in code layout profile %s: %s", profile, line);
+                }
+                edges.add(edge);
+            }
+        } catch (IOException e) {
+            throw UserError.abort(e, "Cannot read code layout profile %s", profile);
+        }
+        return edges;
+    }
+
+    /**
+     * Converts the execution samples of a JFR recording into call edges. Inlined frames are part of
+     * the compiled method below them, so the edge of a sample goes from the second to the first
+     * compiled method on the stack. Samples without a compiled caller only count for the sampled
+     * method itself.
+     */
+    private static List<String[]> readJfrProfile(Path profile) {
+        Map<String, Map<String, Long>> counts = new HashMap<>();
+        try (RecordingFile recording = new RecordingFile(profile)) {
+            while (recording.hasMoreEvents()) {
+                RecordedEvent event = recording.readEvent();
+                RecordedStackTrace stackTrace = event.getStackTrace();
+                if (!event.getEventType().getName().equals(EXECUTION_SAMPLE_EVENT) || stackTrace == null) {
+                    continue;
+                }
+                String callee = null;
+                String caller = null;
+                for (RecordedFrame frame : stackTrace.getFrames()) {
+                    if (!frame.isJavaFrame() || INLINED_FRAME_TYPE.equals(frame.getType())) {
+                        continue;
+                    }
+                    String name = methodName(frame.getMethod());
+                    if (callee == null) {
+                        callee = name;
+                    } else {
+                        caller = name;
+                        break;
+                    }
+                }
+                if (callee != null) {
+                    counts.computeIfAbsent(caller == null ? callee : caller, k -> new HashMap<>()).merge(callee, 1L, Long::sum);
+                }
+            }
+        } catch (IOException e) {
+            throw UserError.abort(e, "Cannot read code layout profile %s", profile);
+        }
+        List<String[]> edges = new ArrayList<>();
+        counts.forEach((caller, callees) -> callees.forEach((callee, count) -> edges.add(new String[]{caller, callee, String.valueOf(count)})));
+        return edges;
+    }
+
+    /** Formats a method of a JFR recording like {@code HostedMethod.format("%H.%n(%P)")}. */
+    private static String methodName(RecordedMethod method) {
+        String descriptor = method.getDescriptor();
+        StringBuilder result = new StringBuilder(method.getType().getName()).append('.').append(method.getName()).append('(');
+        int pos = 1;
+        while (pos < descriptor.length() && descriptor.charAt(pos) != ')') {
+            int dimensions = 0;
+            while (descriptor.charAt(pos) == '[') {
+                dimensions++;
+                pos++;
+            }
+            if (result.charAt(result.length() - 1) != '(') {
+                result.append(", ");
+            }
+            if (descriptor.charAt(pos) == 'L') {
+                int end = descriptor.indexOf(';', pos);
+                result.append(descriptor.substring(pos + 1, end).replace('/', '.'));
+                pos = end + 1;
+            } else {
+                result.append(JavaKind.fromPrimitiveOrVoidTypeChar(descriptor.charAt(pos)).getJavaName());
+                pos++;
+            }
+            result.append("[]".repeat(dimensions));
+        }
+        return result.append(')').toString();
+    }
+
+    private static long parseCount(String count) {
+        try {
+            return Long.parseLong(count.trim());
+        } catch (NumberFormatException e) {
+            throw UserError.abort("Invalid call count in code layout profile: %s", count);
+        }
+    }
+}
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.hosted.image;
+
+import java.io.BufferedWriter;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.IdentityHashMap;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.stream.IntStream;
+
+import com.oracle.svm.core.util.json.JsonWriter;
+import com.oracle.svm.hosted.image.NativeImageHeap.HeapInclusionReason;
+import com.oracle.svm.hosted.image.NativeImageHeap.ObjectInfo;
+import com.oracle.svm.hosted.meta.HostedField;
+
+/**
+ * Dominator tree of the image heap, used to report the retained size of static fields, of methods
+ * that embed constants, and of individual objects: the retained size of a node is the total size
+ * of all objects that are only reachable from the roots via that node, i.e., that would disappear
+ * from the image heap if the node was removed.
+ *
+ * The graph has one node per object, one node per distinct root (see
+ * {@link #rootName(Object)}) and a virtual root above all roots. The predecessors of each object
+ * are derived from its {@link NativeImageHeap#objectReachabilityInfo reachability info} in
+ * parallel. The dominators are then computed with the iterative algorithm of Cooper, Harvey and
+ * Kennedy, which only needs flat int arrays, so it scales to heaps with millions of objects. Unlike
+ * the original formulation, every pass computes all nodes in parallel from the result of the
+ * previous pass (Jacobi-style), and the passes start from the depth-first spanning tree instead of
+ * from undefined dominators, so deep object chains do not need one pass per level.
+ */
+public class ImageHeapDominatorTree {
+    private static final int UNDEFINED = -1;
+    private static final int VIRTUAL_ROOT = 0;
+
+    private final ObjectInfo[] objects;
+    private final Object[] roots;
+    /** The objects have the node ids {@code [firstObject, nodeCount)}. */
+    private final int firstObject;
+    private final int nodeCount;
+    private final int[] dominators;
+    private final long[] retainedSizes;
+
+    public ImageHeapDominatorTree(NativeImageHeap heap) {
+        this.objects = heap.getObjects().stream()
+                        .filter(info -> !info.getMainReason().equals(HeapInclusionReason.FillerObject))
+                        .toArray(ObjectInfo[]::new);
+
+        Map<ObjectInfo, Integer> objectIds = new IdentityHashMap<>(objects.length);
+        Map<Object, Integer> rootIds = new ConcurrentHashMap<>();
+        List<Object> rootList = new ArrayList<>();
+        for (ObjectInfo object : objects) {
+            for (Object reason : heap.objectReachabilityInfo.get(object).getAllReasons()) {
+                if (!(reason instanceof ObjectInfo)) {
+                    rootIds.computeIfAbsent(rootName(reason), name -> {
+                        rootList.add(reason);
+                        return rootList.size();
+                    });
+                }
+            }
+        }
+        this.roots = rootList.toArray();
+        this.firstObject = roots.length + 1;
+        this.nodeCount = firstObject + objects.length;
+        for (int i = 0; i < objects.length; i++) {
+            objectIds.put(objects[i], firstObject + i);
+        }
+
+        int[][] predecessors = new int[nodeCount][];
+        predecessors[VIRTUAL_ROOT] = new int[0];
+        for (int i = 1; i < firstObject; i++) {
+            predecessors[i] = new int[]{VIRTUAL_ROOT};
+        }
+        IntStream.range(0, objects.length).parallel().forEach(i -> {
+            Object[] reasons = heap.objectReachabilityInfo.get(objects[i]).getAllReasons().toArray();
+            int[] preds = new int[reasons.length];
+            int count = 0;
+            for (Object reason : reasons) {
+                Integer id = reason instanceof ObjectInfo ? objectIds.get(reason) : rootIds.get(rootName(reason));
+                if (id != null) {
+                    preds[count++] = id;
+                }
+            }
+            /* Objects without a known reason are treated as roots themselves. */
+            predecessors[firstObject + i] = count == 0 ? new int[]{VIRTUAL_ROOT} : Arrays.copyOf(preds, count);
+        });
+
+        int[] spanningTreeParents = new int[nodeCount];
+        int[] postOrder = computePostOrder(predecessors, spanningTreeParents);
+        this.dominators = computeDominators(predecessors, postOrder, spanningTreeParents);
+        this.retainedSizes = computeRetainedSizes(postOrder);
+    }
+
+    /**
+     * Roots are static fields, methods that embed the object as a constant (identified by the
+     * method name), and internal reasons such as the interned strings table.
+     */
+    private static String rootName(Object reason) {
+        if (reason instanceof HostedField) {
+            return ((HostedField) reason).format("%H#%n");
+        }
+        return reason.toString();
+    }
+
+    private static String rootKind(Object reason) {
+        if (reason instanceof HostedField) {
+            return "staticField";
+        } else if (reason instanceof String) {
+            return "method";
+        } else {
+            return "svmInternal";
+        }
+    }
+
+    private int[] computePostOrder(int[][] predecessors, int[] spanningTreeParents) {
+        int[] successorCounts = new int[nodeCount + 1];
+        for (int[] preds : predecessors) {
+            for (int pred : preds) {
+                successorCounts[pred + 1]++;
+            }
+        }
+        for (int i = 0; i < nodeCount; i++) {
+            successorCounts[i + 1] += successorCounts[i];
+        }
+        int[] successorStarts = successorCounts.clone();
+        int[] successors = new int[successorCounts[nodeCount]];
+        int[] fill = Arrays.copyOf(successorStarts, nodeCount);
+        for (int node = 0; node < nodeCount; node++) {
+            for (int pred : predecessors[node]) {
+                successors[fill[pred]++] = node;
+            }
+        }
+
+        /* Iterative depth-first search, the heap graph is far too deep for recursion. */
+        int[] postOrder = new int[nodeCount];
+        Arrays.fill(postOrder, UNDEFINED);
+        boolean[] visited = new boolean[nodeCount];
+        int[] stack = new int[nodeCount];
+        int[] nextSuccessor = new int[nodeCount];
+        int stackSize = 0;
+        int postOrderNumber = 0;
+        int unvisitedCursor = firstObject;
+        stack[stackSize++] = VIRTUAL_ROOT;
+        visited[VIRTUAL_ROOT] = true;
+        nextSuccessor[VIRTUAL_ROOT] = successorStarts[VIRTUAL_ROOT];
+        while (stackSize > 0) {
+            int node = stack[stackSize - 1];
+            if (nextSuccessor[node] < successorStarts[node + 1]) {
+                int successor = successors[nextSuccessor[node]++];
+                if (!visited[successor]) {
+                    visited[successor] = true;
+                    spanningTreeParents[successor] = node;
+                    nextSuccessor[successor] = successorStarts[successor];
+                    stack[stackSize++] = successor;
+                }
+            } else if (node == VIRTUAL_ROOT && (unvisitedCursor = nextUnvisited(visited, unvisitedCursor)) < nodeCount) {
+                /*
+                 * Cycles of objects that are not reachable from any root: attach them to the
+                 * virtual root so that every node has a dominator.
+                 */
+                int[] preds = predecessors[unvisitedCursor];
+                predecessors[unvisitedCursor] = Arrays.copyOf(preds, preds.length + 1);
+                predecessors[unvisitedCursor][preds.length] = VIRTUAL_ROOT;
+                visited[unvisitedCursor] = true;
+                spanningTreeParents[unvisitedCursor] = VIRTUAL_ROOT;
+                nextSuccessor[unvisitedCursor] = successorStarts[unvisitedCursor];
+                stack[stackSize++] = unvisitedCursor;
+            } else {
+                stackSize--;
+                postOrder[node] = postOrderNumber++;
+            }
+        }
+        return postOrder;
+    }
+
+    private int nextUnvisited(boolean[] visited, int from) {
+        int node = from;
+        while (node < nodeCount && visited[node]) {
+            node++;
+        }
+        return node;
+    }
+
+    /**
+     * Every node's path in the spanning tree contains all of its dominators, so the spanning tree is
+     * a safe starting point that the passes only refine. Because a node's parent in the spanning tree
+     * is always one of its predecessors and finishes after it, every intermediate result keeps the
+     * property that a node's dominator has a higher post-order number, which {@link #intersect}
+     * relies on.
+     */
+    private int[] computeDominators(int[][] predecessors, int[] postOrder, int[] spanningTreeParents) {
+        int[] idom = spanningTreeParents;
+        idom[VIRTUAL_ROOT] = VIRTUAL_ROOT;
+        int[] next = new int[nodeCount];
+        next[VIRTUAL_ROOT] = VIRTUAL_ROOT;
+        while (true) {
+            int[] current = idom;
+            int[] result = next;
+            IntStream.range(1, nodeCount).parallel().forEach(node -> {
+                int[] preds = predecessors[node];
+                int newIdom = preds[0];
+                for (int i = 1; i < preds.length; i++) {
+                    newIdom = intersect(current, postOrder, preds[i], newIdom);
+                }
+                result[node] = newIdom;
+            });
+            if (Arrays.equals(current, result)) {
+                return result;
+            }
+            next = current;
+            idom = result;
+        }
+    }
+
+    private static int intersect(int[] idom, int[] postOrder, int a, int b) {
+        int finger1 = a;
+        int finger2 = b;
+        while (finger1 != finger2) {
+            while (postOrder[finger1] < postOrder[finger2]) {
+                finger1 = idom[finger1];
+            }
+            while (postOrder[finger2] < postOrder[finger1]) {
+                finger2 = idom[finger2];
+            }
+        }
+        return finger1;
+    }
+
+    private long[] computeRetainedSizes(int[] postOrder) {
+        long[] sizes = new long[nodeCount];
+        int[] nodesInPostOrder = new int[nodeCount];
+        for (int node = 0; node < nodeCount; node++) {
+            nodesInPostOrder[postOrder[node]] = node;
+            if (node >= firstObject) {
+                sizes[node] = objects[node - firstObject].getSize();
+            }
+        }
+        /* A dominator is always finished after the nodes it dominates. */
+        for (int node : nodesInPostOrder) {
+            if (node != VIRTUAL_ROOT) {
+                sizes[dominators[node]] += sizes[node];
+            }
+        }
+        return sizes;
+    }
+
+    private int[] topNodes(int from, int to, int limit) {
+        return IntStream.range(from, to).boxed()
+                        .sorted(Comparator.comparingLong((Integer node) -> retainedSizes[node]).reversed())
+                        .limit(limit)
+                        .mapToInt(Integer::intValue)
+                        .toArray();
+    }
+
+    /** Returns the root that the object hangs below in the dominator tree. */
+    private Object dominatingRoot(int node) {
+        int current = node;
+        while (dominators[current] != VIRTUAL_ROOT) {
+            current = dominators[current];
+        }
+        return current < firstObject ? roots[current - 1] : null;
+    }
+
+    /**
+     * Prints the roots and the objects with the largest retained sizes as JSON.
+     */
+    public void printTopRetainers(PrintWriter out, int limit) {
+        try (JsonWriter writer = new JsonWriter(new BufferedWriter(out))) {
+            writer.append('{').newline();
+            writer.quote("totalBytes").append(':').append(String.valueOf(retainedSizes[VIRTUAL_ROOT])).append(',').newline();
+            writer.quote("roots").append(":[").newline();
+            for (Iterator<Integer> iterator = Arrays.stream(topNodes(1, firstObject, limit)).iterator(); iterator.hasNext();) {
+                int node = iterator.next();
+                Object root = roots[node - 1];
+                writer.append('{');
+                writer.quote("kind").append(':').quote(rootKind(root)).append(',');
+                writer.quote("name").append(':').quote(rootName(root)).append(',');
+                writer.quote("retainedBytes").append(':').append(String.valueOf(retainedSizes[node]));
+                writer.append('}');
+                if (iterator.hasNext()) {
+                    writer.append(',').newline();
+                }
+            }
+            writer.newline().append("],").newline();
+            writer.quote("objects").append(":[").newline();
+            for (Iterator<Integer> iterator = Arrays.stream(topNodes(firstObject, nodeCount, limit)).iterator(); iterator.hasNext();) {
+                int node = iterator.next();
+                ObjectInfo object = objects[node - firstObject];
+                Object root = dominatingRoot(node);
+                writer.append('{');
+                writer.quote("className").append(':').quote(object.getObject().getClass().getName()).append(',');
+                writer.quote("identityHashCode").append(':').quote(String.valueOf(object.getIdentityHashCode())).append(',');
+                writer.quote("retainedBytes").append(':').append(String.valueOf(retainedSizes[node])).append(',');
+                writer.quote("root").append(':').quote(root == null ? "" : rootName(root));
+                writer.append('}');
+                if (iterator.hasNext()) {
+                    writer.append(',').newline();
+                }
+            }
+            writer.newline().append(']').newline();
+            writer.append('}').newline();
+        } catch (IOException e) {
+            out.write("{\"Error\":\"Failed to generate the report\"");
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.hosted.image;
+
+import org.graalvm.compiler.options.Option;
+
+import com.oracle.graal.pointsto.reports.ReportUtils;
+import com.oracle.svm.core.SubstrateOptions;
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.option.HostedOptionKey;
+import com.oracle.svm.core.util.VMError;
+import com.oracle.svm.hosted.FeatureImpl.AfterHeapLayoutAccessImpl;
+
+@AutomaticallyRegisteredFeature
+public class ImageHeapDominatorTreeFeature implements InternalFeature {
+
+    static final class Options {
+        @Option(help = "Print a report of the static fields, methods and objects that retain the most bytes of the image heap.")//
+        static final HostedOptionKey<Boolean> PrintImageHeapRetainedSizes = new HostedOptionKey<>(false);
+
+        @Option(help = "Number of roots and objects listed in the report of PrintImageHeapRetainedSizes.")//
+        static final HostedOptionKey<Integer> ImageHeapRetainedSizesLimit = new HostedOptionKey<>(100);
+    }
+
+    /**
+     * Returns true if {@link NativeImageHeap} has to record the
+     * {@link NativeImageHeap#objectReachabilityInfo reachability info} of its objects, which both the
+     * connected components report and the retained sizes report are computed from.
+     */
+    static boolean isReachabilityInfoRequired() {
+        return ImageHeapConnectedComponentsFeature.Options.PrintImageHeapConnectedComponents.getValue() || Options.PrintImageHeapRetainedSizes.getValue();
+    }
+
+    @Override
+    public boolean isInConfiguration(IsInConfigurationAccess access) {
+        return Options.PrintImageHeapRetainedSizes.getValue();
+    }
+
+    @Override
+    public void afterHeapLayout(AfterHeapLayoutAccess a) {
+        AfterHeapLayoutAccessImpl access = (AfterHeapLayoutAccessImpl) a;
+        VMError.guarantee(access.getHeap().objectReachabilityInfo != null, "Image heap reachability info is not available");
+        ImageHeapDominatorTree dominatorTree = new ImageHeapDominatorTree(access.getHeap());
+        String imageName = ReportUtils.extractImageName(SubstrateOptions.Name.getValue());
+        ReportUtils.report("image heap retained sizes", SubstrateOptions.reportsPath(), "image_heap_retained_sizes_" + imageName, "json",
+                        out -> dominatorTree.printTopRetainers(out, Options.ImageHeapRetainedSizesLimit.getValue()));
+    }
+}
@@ -69,6 +69,12 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
     private final Map<HostedMethod, Map<HostedMethod, Integer>> trampolineMap;
     private final Map<HostedMethod, List<Pair<HostedMethod, Integer>>> orderedTrampolineMap;
     private final Map<HostedMethod, Integer> compilationPosition;
+    /**
+     * Position of the first method that is placed after a huge page boundary, or -1. Set by
+     * {@link #computeCompilationOrder}, which runs in the super constructor, so this field must not
+     * have an initializer.
+     */
+    private int coldCodePosition;
 
     private final TargetDescription target;
 
@@ -86,6 +92,29 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
         }
     }
 
+    @Override
+    protected List<Pair<HostedMethod, CompilationResult>> computeCompilationOrder(Map<HostedMethod, CompilationResult> compilationMap) {
+        List<Pair<HostedMethod, CompilationResult>> defaultOrder = super.computeCompilationOrder(compilationMap);
+        if (CallChainClusteringOrder.isEnabled()) {
+            CallChainClusteringOrder layout = CallChainClusteringOrder.computeOrder(defaultOrder);
+            coldCodePosition = CallChainClusteringOrder.splitColdCode() ? layout.getProfiledMethodCount() : -1;
+            return layout.getOrder();
+        }
+        coldCodePosition = -1;
+        return defaultOrder;
+    }
+
+    /**
+     * Returns the start of the method at {@code position} in the compilation order, given that the
+     * previous method ends at {@code curPos}.
+     */
+    private int computeMethodStart(int position, int curPos) {
+        if (position == coldCodePosition) {
+            return NumUtil.roundUp(curPos, CallChainClusteringOrder.HUGE_PAGE_SIZE);
+        }
+        return curPos;
+    }
+
     @Override
     public int getCodeCacheSize() {
         assert codeCacheSize > 0;
@@ -121,10 +150,12 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
     private boolean verifyMethodLayout() {
         HostedDirectCallTrampolineSupport trampolineSupport = HostedDirectCallTrampolineSupport.singleton();
         int currentPos = 0;
+        int position = 0;
         for (Pair<HostedMethod, CompilationResult> entry : getOrderedCompilations()) {
             HostedMethod method = entry.getLeft();
             CompilationResult compilation = entry.getRight();
 
+            currentPos = computeMethodStart(position++, currentPos);
             int methodStart = method.getCodeAddressOffset();
             assert currentPos == methodStart;
 
@@ -159,10 +190,12 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
             Map<HostedMethod, Integer> curOffsetMap = trampolineSupport.mayNeedTrampolines() ? new HashMap<>() : null;
 
             int curPos = 0;
+            int position = 0;
             for (Pair<HostedMethod, CompilationResult> entry : getOrderedCompilations()) {
                 HostedMethod method = entry.getLeft();
                 CompilationResult compilation = entry.getRight();
 
+                curPos = computeMethodStart(position++, curPos);
                 if (!trampolineSupport.mayNeedTrampolines()) {
                     method.setCodeAddressOffset(curPos);
                 } else {
@@ -250,6 +283,7 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
                 CompilationResult compilation = entry.getRight();
 
                 int originalStart = curOffsetMap.get(caller);
+                curPos = computeMethodStart(callerCompilationNum, curPos);
                 int newStart = curPos;
                 curOffsetMap.put(caller, newStart);
 
@@ -442,6 +476,10 @@ public class LIRNativeImageCodeCache extends NativeImageCodeCache {
             HostedMethod method = compilationPair.getLeft();
             CompilationResult compilation = compilationPair.getRight();
 
+            /* Fill the gap in front of the cold code. */
+            while (bufferBytes.position() < startPos + method.getCodeAddressOffset()) {
+                bufferBytes.put(CODE_FILLER_BYTE);
+            }
             bufferBytes.position(startPos + method.getCodeAddressOffset());
             bufferBytes.put(compilation.getTargetCode(), 0, compilation.getTargetCodeSize());
 
@@ -32,6 +32,7 @@ import java.nio.file.Path;
 import org.graalvm.compiler.debug.DebugContext;
 import org.graalvm.compiler.debug.DebugContext.Builder;
 import org.graalvm.compiler.debug.Indent;
+import org.graalvm.compiler.options.Option;
 import org.graalvm.compiler.printer.GraalDebugHandlersFactory;
 
 import com.oracle.graal.pointsto.util.GraalAccess;
@@ -41,6 +42,7 @@ import com.oracle.svm.core.BuildArtifacts.ArtifactType;
 import com.oracle.svm.core.SubstrateOptions;
 import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
 import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.option.HostedOptionKey;
 import com.oracle.svm.core.option.HostedOptionValues;
 import com.oracle.svm.core.util.InterruptImageBuilding;
 import com.oracle.svm.core.util.UserError;
@@ -50,9 +52,18 @@ import com.oracle.svm.hosted.c.util.FileUtils;
 @AutomaticallyRegisteredFeature
 public class NativeImageDebugInfoStripFeature implements InternalFeature {
 
+    public static class Options {
+        @Option(help = "Compress the DWARF debug sections with zlib (SHF_COMPRESSED). Applies to the separate debuginfo file if debuginfo is stripped, otherwise to the executable.")//
+        public static final HostedOptionKey<Boolean> CompressDebugInfo = new HostedOptionKey<>(false);
+    }
+
+    private static final String OBJCOPY_EXE = "objcopy";
+    private static final String COMPRESS_DEBUG_SECTIONS = "--compress-debug-sections=zlib";
+
     @Override
     public boolean isInConfiguration(IsInConfigurationAccess access) {
-        return SubstrateOptions.GenerateDebugInfo.getValue() > 0 && SubstrateOptions.StripDebugInfo.getValue() && (SubstrateOptions.useLIRBackend() || SubstrateOptions.useLLVMBackend());
+        boolean postProcess = SubstrateOptions.StripDebugInfo.getValue() || Options.CompressDebugInfo.getValue();
+        return SubstrateOptions.GenerateDebugInfo.getValue() > 0 && postProcess && (SubstrateOptions.useLIRBackend() || SubstrateOptions.useLLVMBackend());
     }
 
     @SuppressWarnings("try")
@@ -60,10 +71,11 @@ public class NativeImageDebugInfoStripFeature implements InternalFeature {
     public void afterImageWrite(AfterImageWriteAccess access) {
         AfterImageWriteAccessImpl accessImpl = (AfterImageWriteAccessImpl) access;
         DebugContext debugContext = new Builder(HostedOptionValues.singleton(), new GraalDebugHandlersFactory(GraalAccess.getOriginalSnippetReflection())).build();
-        try (Indent indent = debugContext.logAndIndent("Stripping debuginfo")) {
+        String action = SubstrateOptions.StripDebugInfo.getValue() ? "Stripping debuginfo" : "Compressing debuginfo";
+        try (Indent indent = debugContext.logAndIndent(action)) {
             switch (ObjectFile.getNativeFormat()) {
                 case ELF:
-                    stripLinux(accessImpl);
+                    processLinux(accessImpl);
                     break;
                 case PECOFF:
                     // debug info is always "stripped" to a pdb file
@@ -77,29 +89,60 @@ public class NativeImageDebugInfoStripFeature implements InternalFeature {
         }
     }
 
+    private static boolean isObjcopyAvailable() {
+        try {
+            return FileUtils.executeCommand(OBJCOPY_EXE, "--version") == 0;
+        } catch (IOException e) {
+            return false;
+        } catch (InterruptedException e) {
+            throw new InterruptImageBuilding("Interrupted during checking for " + OBJCOPY_EXE + " availability");
+        }
+    }
+
+    private static void processLinux(AfterImageWriteAccessImpl accessImpl) {
+        if (SubstrateOptions.StripDebugInfo.getValue()) {
+            stripLinux(accessImpl);
+        } else {
+            compressLinux(accessImpl);
+        }
+    }
+
+    private static void compressLinux(AfterImageWriteAccessImpl accessImpl) {
+        Path imagePath = accessImpl.getImagePath();
+        if (!isObjcopyAvailable()) {
+            System.out.printf("Warning: %s not available. Skipping compression of the debuginfo of %s%n", OBJCOPY_EXE, imagePath.getFileName());
+            return;
+        }
+        try {
+            int exitCode = FileUtils.executeCommand(OBJCOPY_EXE, COMPRESS_DEBUG_SECTIONS, imagePath.toString());
+            if (exitCode != 0) {
+                throw UserError.abort("Compression of debuginfo failed: %s exited with code %d", OBJCOPY_EXE, exitCode);
+            }
+        } catch (IOException e) {
+            throw UserError.abort("Compression of debuginfo failed", e);
+        } catch (InterruptedException e) {
+            throw new InterruptImageBuilding("Interrupted during debuginfo compression of image " + imagePath.getFileName());
+        }
+    }
+
     private static void stripLinux(AfterImageWriteAccessImpl accessImpl) {
-        String objcopyExe = "objcopy";
+        String objcopyExe = OBJCOPY_EXE;
         String debugExtension = ".debug";
         Path imagePath = accessImpl.getImagePath();
         Path imageName = imagePath.getFileName();
         Path outputDirectory = imagePath.getParent();
         String debugInfoName = imageName + debugExtension;
-        boolean objcopyAvailable = false;
-        try {
-            objcopyAvailable = FileUtils.executeCommand(objcopyExe, "--version") == 0;
-        } catch (IOException e) {
-            /* Fall through to `if (!objcopyAvailable)` */
-        } catch (InterruptedException e) {
-            throw new InterruptImageBuilding("Interrupted during checking for " + objcopyExe + " availability");
-        }
 
-        if (!objcopyAvailable) {
+        if (!isObjcopyAvailable()) {
             System.out.printf("Warning: %s not available. Skipping generation of separate debuginfo file %s, debuginfo will remain embedded in the executable%n", objcopyExe, debugInfoName);
         } else {
             try {
                 String imageFilePath = outputDirectory.resolve(imageName).toString();
                 Path debugInfoFilePath = outputDirectory.resolve(debugInfoName);
-                FileUtils.executeCommand(objcopyExe, "--only-keep-debug", imageFilePath, debugInfoFilePath.toString());
+                if (!extractDebugInfo(objcopyExe, imageFilePath, debugInfoFilePath)) {
+                    System.out.printf("Warning: %s failed to extract the debuginfo into %s, debuginfo will remain embedded in the executable%n", objcopyExe, debugInfoName);
+                    return;
+                }
                 BuildArtifacts.singleton().add(ArtifactType.DEBUG_INFO, debugInfoFilePath);
                 Path exportedSymbolsPath = createKeepSymbolsListFile(accessImpl);
                 FileUtils.executeCommand(objcopyExe, "--strip-all", "--keep-symbols=" + exportedSymbolsPath, imageFilePath);
@@ -112,6 +155,23 @@ public class NativeImageDebugInfoStripFeature implements InternalFeature {
         }
     }
 
+    /**
+     * Writes the debug sections of the image into a separate file, compressed if requested. If
+     * compression is not supported by the installed {@code objcopy}, the sections are extracted
+     * uncompressed instead. Returns false if no debuginfo file could be written, in which case the
+     * image must not be stripped.
+     */
+    private static boolean extractDebugInfo(String objcopyExe, String imageFilePath, Path debugInfoFilePath) throws IOException, InterruptedException {
+        if (Options.CompressDebugInfo.getValue()) {
+            if (FileUtils.executeCommand(objcopyExe, "--only-keep-debug", COMPRESS_DEBUG_SECTIONS, imageFilePath, debugInfoFilePath.toString()) == 0) {
+                return true;
+            }
+            System.out.printf("Warning: %s failed to compress the debuginfo of %s, the separate debuginfo file will be uncompressed%n", objcopyExe, debugInfoFilePath.getFileName());
+            Files.deleteIfExists(debugInfoFilePath);
+        }
+        return FileUtils.executeCommand(objcopyExe, "--only-keep-debug", imageFilePath, debugInfoFilePath.toString()) == 0;
+    }
+
     private static Path createKeepSymbolsListFile(AfterImageWriteAccessImpl accessImpl) throws IOException {
         Path exportedSymbolsPath = accessImpl.getTempDirectory().resolve("keep-symbols.list").toAbsolutePath();
         Files.write(exportedSymbolsPath, accessImpl.getImageSymbols(false));
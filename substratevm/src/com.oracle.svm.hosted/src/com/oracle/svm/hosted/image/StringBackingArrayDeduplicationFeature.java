@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.oracle.svm.hosted.image;
+
+import java.lang.reflect.Field;
+import java.util.Collections;
+import java.util.IdentityHashMap;
+import java.util.Map;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+
+import org.graalvm.compiler.options.Option;
+
+import com.oracle.svm.core.feature.AutomaticallyRegisteredFeature;
+import com.oracle.svm.core.feature.InternalFeature;
+import com.oracle.svm.core.option.HostedOptionKey;
+import com.oracle.svm.core.util.VMError;
+import com.oracle.svm.hosted.FeatureImpl.AfterHeapLayoutAccessImpl;
+import com.oracle.svm.hosted.image.NativeImageHeap.ObjectInfo;
+import com.oracle.svm.util.ReflectionUtil;
+
+/**
+ * Shares the backing arrays of equal strings in the image heap, so that strings that are equal but
+ * reached via different object paths only carry one copy of their characters. The string objects
+ * themselves are kept, so their identity does not change. The backing array of a string is never
+ * modified and never escapes from it.
+ * <p>
+ * The sharing is done by a field value transformer for {@code String.value}, i.e., only the image
+ * heap sees the canonical arrays. The strings of the image generator itself are not modified.
+ */
+@AutomaticallyRegisteredFeature
+public class StringBackingArrayDeduplicationFeature implements InternalFeature {
+
+    public static class Options {
+        @Option(help = "Share the backing arrays of equal strings in the image heap. Strings must not be modified via reflection or Unsafe when enabled.")//
+        public static final HostedOptionKey<Boolean> DeduplicateStringBackingArrays = new HostedOptionKey<>(false);
+    }
+
+    /** Number and image heap size of the backing arrays that were not written to a partition. */
+    public static final class SavedSize {
+        private long count;
+        private long size;
+
+        public long getCount() {
+            return count;
+        }
+
+        public long getSize() {
+            return size;
+        }
+    }
+
+    private static final Field STRING_VALUE = ReflectionUtil.lookupField(String.class, "value");
+
+    /**
+     * The canonical backing array for each distinct string content. Keys and values are strings
+     * and arrays of the image heap, so the map does not keep any other objects alive.
+     */
+    private final ConcurrentMap<String, Object> canonicalValues = new ConcurrentHashMap<>();
+    /** Saved sizes per image heap partition, computed after the heap layout. */
+    private final Map<String, SavedSize> savedSizes = new TreeMap<>();
+
+    @Override
+    public boolean isInConfiguration(IsInConfigurationAccess access) {
+        return Options.DeduplicateStringBackingArrays.getValue();
+    }
+
+    @Override
+    public void beforeAnalysis(BeforeAnalysisAccess access) {
+        access.registerFieldValueTransformer(STRING_VALUE, (receiver, originalValue) -> {
+            Object canonical = canonicalValues.putIfAbsent((String) receiver, originalValue);
+            return canonical == null ? originalValue : canonical;
+        });
+    }
+
+    @Override
+    public void afterHeapLayout(AfterHeapLayoutAccess a) {
+        NativeImageHeap heap = ((AfterHeapLayoutAccessImpl) a).getHeap();
+        Set<Object> replacedValues = Collections.newSetFromMap(new IdentityHashMap<>());
+        for (ObjectInfo info : heap.getObjects()) {
+            if (!(info.getObject() instanceof String)) {
+                continue;
+            }
+            String string = (String) info.getObject();
+            Object value = readValue(string);
+            Object canonical = canonicalValues.get(string);
+            if (canonical == null || canonical == value || heap.getObjectInfo(value) != null || !replacedValues.add(value)) {
+                /* Not replaced, or the original array is still in the image heap. */
+                continue;
+            }
+            /* The replaced array has the same type and length as the canonical array. */
+            ObjectInfo canonicalInfo = heap.getObjectInfo(canonical);
+            SavedSize saved = savedSizes.computeIfAbsent(canonicalInfo.getPartition().getName(), k -> new SavedSize());
+            saved.count++;
+            saved.size += canonicalInfo.getSize();
+        }
+    }
+
+    private static Object readValue(String string) {
+        try {
+            return STRING_VALUE.get(string);
+        } catch (IllegalAccessException e) {
+            throw VMError.shouldNotReachHere(e);
+        }
+    }
+
+    /** Returns the saved sizes by image heap partition name. Available after the heap layout. */
+    public Map<String, SavedSize> getSavedSizes() {
+        return Collections.unmodifiableMap(savedSizes);
+    }
+}